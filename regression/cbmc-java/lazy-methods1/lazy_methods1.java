@@ -0,0 +1,31 @@
+class A
+{
+  public void f(){}
+
+  // never called
+  public void g(){}
+};
+
+class B extends A
+{
+  public void f()
+  {
+    assert false;
+  }
+};
+
+class lazy_methods1
+{
+  public static void main(String[] args)
+  {
+    A b=new B();
+    b.f(); // this really calls B.f, not A.f
+  }
+
+  // never called, and neither is the constructor
+  public static void unused()
+  {
+    A a=new A();
+    a.g();
+  }
+}
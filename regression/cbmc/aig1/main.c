@@ -0,0 +1,11 @@
+int main()
+{
+  unsigned char a, b;
+  unsigned x=a, y=b;
+
+  assert(x*y==y*x);
+  assert((x<<(b%8))==x*(1u<<(b%8)));
+  assert(x*y!=221);
+
+  return 0;
+}
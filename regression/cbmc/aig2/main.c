@@ -0,0 +1,12 @@
+int main()
+{
+  unsigned char a, b;
+  unsigned sum=a+b;
+  unsigned product=a*b;
+  unsigned mixed=(sum^product)&0xff;
+
+  __CPROVER_assume(a<b);
+  assert(product!=221 || a==1);
+
+  return 0;
+}
@@ -0,0 +1,25 @@
+int main()
+{
+  int x, y, z=0;
+
+  if(x>0)
+  {
+    if(y>0)
+      z=1;
+    else
+      z=2;
+
+    // infeasible
+    if(x<=0)
+      z=3;
+  }
+  else
+    z=4;
+
+  __CPROVER_assert(z!=3, "infeasible branch");
+  __CPROVER_assert(z==1 || z==2 || z==4, "merged");
+  __CPROVER_assert(x<=0 || y<=0 || z==1, "nested");
+  __CPROVER_assert(z!=2, "reachable");
+
+  return 0;
+}
@@ -0,0 +1,13 @@
+int main()
+{
+  __CPROVER_bool c;
+
+  if(c)
+  {
+    // infeasible, which is only seen when the guard is canonical
+    if(!c)
+      __CPROVER_assert(0, "infeasible branch");
+  }
+
+  return 0;
+}
@@ -0,0 +1,16 @@
+int main()
+{
+  unsigned x, y, z;
+
+  if(x>10)
+    z=x*y;
+  else
+    z=x+y;
+
+  if(y&1)
+    z^=0x5555;
+
+  __CPROVER_assert(z!=12345, "property");
+
+  return 0;
+}
@@ -0,0 +1,13 @@
+int nondet_int();
+
+int main()
+{
+  int x=nondet_int();
+  __CPROVER_assume(0<=x && x<=1);
+
+  // no bound is given, the loop runs at most four times
+  while(x<4)
+    x=x+1;
+
+  assert(x==4);
+}
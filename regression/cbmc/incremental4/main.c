@@ -0,0 +1,7 @@
+int main()
+{
+  int i;
+
+  for(i=0; i<10; i++)
+    assert(i<10);
+}
@@ -0,0 +1,11 @@
+int main()
+{
+  unsigned i=0;
+
+  // can't be unwound completely
+  while(1)
+  {
+    i++;
+    assert(i<1000);
+  }
+}
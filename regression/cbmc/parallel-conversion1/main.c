@@ -0,0 +1,27 @@
+int f(int x)
+{
+  return x+1;
+}
+
+int g(int x)
+{
+  return f(x)+f(x);
+}
+
+int h(int x)
+{
+  int y=g(x);
+  return y>0 ? g(y) : f(y);
+}
+
+int main()
+{
+  int x;
+  __CPROVER_assume(x>=0 && x<100);
+
+  assert(f(x)==x+1);
+  assert(g(x)==2*x+2);
+  assert(h(x)!=14);
+
+  return 0;
+}
@@ -0,0 +1,13 @@
+int main()
+{
+  int x, y;
+
+  __CPROVER_assume(x>=0 && x<10);
+
+  assert(x!=3);
+  assert(x<10);
+  assert(y!=x || y<10);
+  assert(x+y!=42);
+
+  return 0;
+}
@@ -0,0 +1,29 @@
+struct S
+{
+  int c[10];
+};
+
+int main()
+{
+  int a[10], b[10];
+  struct S s1, s2;
+  unsigned i, j;
+
+  __CPROVER_assume(i<10 && j<10);
+
+  // read over write
+  a[i]=1;
+  a[j]=2;
+  assert(i==j || a[i]==1);
+
+  // Ackermann: equal indices give equal elements
+  if(i==j)
+    assert(b[i]==b[j]);
+
+  // array equality, by copying a struct
+  s1.c[j]=a[j];
+  s2=s1;
+  assert(s2.c[j]==2);
+
+  return 0;
+}
@@ -0,0 +1,15 @@
+int main()
+{
+  int a[10];
+  unsigned i, j;
+
+  __CPROVER_assume(i<10 && j<10);
+
+  a[i]=1;
+  a[j]=2;
+
+  // fails when i==j
+  assert(a[i]==1);
+
+  return 0;
+}
@@ -0,0 +1,14 @@
+int main()
+{
+  unsigned x, y;
+
+  __CPROVER_assume(x>1 && y>1);
+
+  // holds
+  assert(x*y==y*x);
+
+  // fails, as 65537*65537 overflows to 131073
+  assert(x*y!=131073);
+
+  return 0;
+}
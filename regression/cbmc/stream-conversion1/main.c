@@ -0,0 +1,17 @@
+int main()
+{
+  int x, y, a[4];
+
+  __CPROVER_assume(x>=0 && x<4);
+
+  for(int i=0; i<4; i++)
+    a[i]=i*2;
+
+  y=a[x];
+
+  __CPROVER_assert(y%2==0, "even");
+  __CPROVER_assert(y<=6, "bounded");
+  __CPROVER_assert(y!=4, "reachable");
+
+  return 0;
+}
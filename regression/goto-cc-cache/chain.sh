@@ -0,0 +1,17 @@
+#!/bin/bash
+
+set -e
+
+goto_cc=../../../src/goto-cc/goto-cc
+
+name=${@:$#}
+name=${name%.c}
+
+args=${@:1:$#-1}
+
+# start with an empty cache, and fill it
+rm -rf cache
+$goto_cc --verbosity 10 --cache-dir cache -c $name.c -o $name.o
+
+# compile again, with the options of the test
+$goto_cc --verbosity 10 --cache-dir cache $args -c $name.c -o $name.o
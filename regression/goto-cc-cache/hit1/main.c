@@ -0,0 +1,10 @@
+#ifndef VALUE
+#define VALUE 1
+#endif
+
+int main()
+{
+  int x=VALUE;
+  __CPROVER_assert(x==1, "x is one");
+  return 0;
+}
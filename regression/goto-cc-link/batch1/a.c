@@ -0,0 +1,21 @@
+#include "shared.h"
+
+static int counter=1;
+
+static int get(void)
+{
+  return counter;
+}
+
+struct point make_point(int x, int y)
+{
+  struct point p;
+  p.x=x;
+  p.y=y;
+  return p;
+}
+
+int get_a(void)
+{
+  return get()+make_point(1, 2).y;
+}
@@ -0,0 +1,18 @@
+#include "shared.h"
+
+// complete in c.c only
+struct list;
+struct list *head;
+
+static int counter=2;
+
+__attribute__((weak)) int scale(void)
+{
+  return 1;
+}
+
+int get_b(void)
+{
+  total+=counter;
+  return total;
+}
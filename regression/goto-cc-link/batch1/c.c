@@ -0,0 +1,21 @@
+#include "shared.h"
+
+struct list
+{
+  int value;
+  struct list *next;
+};
+
+static struct list node={ 3, 0 };
+struct list *head=&node;
+
+// overrides the weak one of b.c
+int scale(void)
+{
+  return 2;
+}
+
+int get_c(void)
+{
+  return head->value*scale()+make_point(0, 0).x;
+}
@@ -0,0 +1,20 @@
+#include "shared.h"
+
+int total=10;
+
+static int counter=10;
+
+static int get(void)
+{
+  return counter;
+}
+
+int main()
+{
+  __CPROVER_assert(get()==10, "main");
+  __CPROVER_assert(get_a()==3, "a");
+  __CPROVER_assert(get_b()==12, "b");
+  __CPROVER_assert(get_c()==6, "c");
+  __CPROVER_assert(total==12, "total");
+  return 0;
+}
@@ -0,0 +1,12 @@
+struct point
+{
+  int x, y;
+};
+
+extern int total;
+
+struct point make_point(int x, int y);
+
+int get_a(void);
+int get_b(void);
+int get_c(void);
@@ -0,0 +1,62 @@
+#!/bin/bash
+
+set -e
+
+goto_cc=../../../src/goto-cc/goto-cc
+goto_instrument=../../../src/goto-instrument/goto-instrument
+cbmc=../../../src/cbmc/cbmc
+
+name=${@:$#}
+name=${name%.c}
+
+args=${@:1:$#-1}
+
+# compile each file of the test separately
+for src in *.c ; do
+  $goto_cc -c $src -o ${src%.c}.o
+done
+
+# the one of the test first
+objects="$name.o $(ls *.o | grep -v "^$name\.o$")"
+
+# link the objects at once, and one at a time, which must agree
+if echo "$args" | grep -q -- "--compare-linking" ; then
+  args=$(echo "$args" | sed 's/--compare-linking//')
+
+  $goto_cc -r $objects -o batch.gb
+
+  serial=""
+  for object in $objects ; do
+    if [ -z "$serial" ] ; then
+      cp $object serial.gb
+    else
+      $goto_cc -r serial.gb $object -o serial-next.gb
+      mv serial-next.gb serial.gb
+    fi
+    serial=serial.gb
+  done
+
+  # the order of the functions and the location numbers depend on
+  # the order in which the identifiers were read
+  for show in --show-symbol-table --show-goto-functions ; do
+    $goto_instrument $show batch.gb | \
+      sed -E 's|^( *// )[0-9]+ |\1|' | sort > batch.txt
+    $goto_instrument $show serial.gb | \
+      sed -E 's|^( *// )[0-9]+ |\1|' | sort > serial.txt
+    if cmp -s batch.txt serial.txt ; then
+      echo "same $show when linking one at a time"
+    else
+      diff batch.txt serial.txt || true
+    fi
+  done
+fi
+
+# link into an executable, and give cbmc that one alone
+if echo "$args" | grep -q -- "--executable" ; then
+  args=$(echo "$args" | sed 's/--executable//')
+
+  $goto_cc $objects -o $name.gb
+  objects=$name.gb
+fi
+
+$cbmc $args $objects
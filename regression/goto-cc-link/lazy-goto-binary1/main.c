@@ -0,0 +1,21 @@
+#include <assert.h>
+
+void unused(void)
+{
+  assert(0);
+}
+
+void called(int x)
+{
+  assert(x!=2);
+}
+
+void (*fp)(int)=called;
+
+int main()
+{
+  int x;
+  // called is only reachable via the function pointer
+  fp(x);
+  return 0;
+}
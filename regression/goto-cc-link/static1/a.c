@@ -0,0 +1,11 @@
+static int counter=1;
+
+static int get(void)
+{
+  return counter;
+}
+
+int get_a(void)
+{
+  return get();
+}
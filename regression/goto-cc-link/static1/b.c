@@ -0,0 +1,11 @@
+static int counter=2;
+
+static int get(void)
+{
+  return counter;
+}
+
+int get_b(void)
+{
+  return get();
+}
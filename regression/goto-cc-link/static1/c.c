@@ -0,0 +1,11 @@
+static int counter=3;
+
+static int get(void)
+{
+  return counter;
+}
+
+int get_c(void)
+{
+  return get();
+}
@@ -0,0 +1,20 @@
+int get_a(void);
+int get_b(void);
+int get_c(void);
+
+static int counter=10;
+
+static int get(void)
+{
+  return counter;
+}
+
+int main()
+{
+  __CPROVER_assert(get()==10, "main");
+  __CPROVER_assert(get_a()==1, "a");
+  __CPROVER_assert(get_b()==2, "b");
+  __CPROVER_assert(get_c()==3, "c");
+  __CPROVER_assert(get_a()+get_b()+get_c()==6, "all");
+  return 0;
+}
@@ -14,8 +14,23 @@ args=${@:1:$#-1}
 
 $goto_cc -o $name.gb $name.c
 # $goto_instrument --show-goto-functions $name.gb
+graph=$(echo "$args" | sed -n 's/.*--slice-graph \([^ ]*\).*/\1/p')
+if [ -n "$graph" ] ; then
+  rm -f $graph
+fi
 $goto_instrument $args $name.gb ${name}-mod.gb
-if [ ! -e ${name}-mod.gb ] ; then
+if echo "$args" | grep -q -- "--property-slices" ; then
+  if [ -n "$graph" ] ; then
+    # the second run reads the dependence graph the first one wrote
+    $goto_instrument $args $name.gb ${name}-mod.gb
+  fi
+  for slice in ${name}-mod.gb.* ; do
+    echo "Slice: $slice"
+    $goto_instrument --show-goto-functions $slice
+    $cbmc $slice
+  done
+  exit 0
+elif [ ! -e ${name}-mod.gb ] ; then
   cp $name.gb ${name}-mod.gb
 elif echo "$args" | grep -q -- "--dump-c" ; then
   mv ${name}-mod.gb ${name}-mod.c
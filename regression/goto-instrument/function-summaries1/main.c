@@ -0,0 +1,20 @@
+int g;
+
+void set_g(void)
+{
+  g=1;
+}
+
+int main()
+{
+  set_g();
+  g=5;
+  set_g();
+  // the same state as at the first call
+  g=0;
+  set_g();
+
+  assert(g==1);
+
+  return 0;
+}
@@ -0,0 +1,14 @@
+int main()
+{
+  int x, y, z;
+
+  x=1;
+  y=2;
+  z=x+y;
+
+  __CPROVER_assert(x==1, "x");
+  __CPROVER_assert(y==2, "y");
+  __CPROVER_assert(z==4, "z");
+
+  return 0;
+}
@@ -0,0 +1,24 @@
+#include <assert.h>
+
+int main()
+{
+  int a, b, c, d;
+  int sum=0;
+
+  if(a) sum+=1;
+  if(b) sum+=2;
+  if(c) sum+=4;
+  if(d) sum+=8;
+
+  // holds on all paths
+  assert(sum>=0 && sum<=15);
+
+  // fails on one path only
+  if(sum==13)
+    assert(a==0);
+
+  // does not hold on any path
+  assert(sum!=sum);
+
+  return 0;
+}
@@ -347,22 +347,35 @@ bool ai_baset::do_function_call(
 
   assert(!goto_function.body.instructions.empty());
 
+  // get the state at the beginning of the function
+  locationt l_begin=goto_function.body.instructions.begin();
+
+  // do the edge from the call site to the beginning of the function
+  std::unique_ptr<statet> entry_state(make_temporary_state(get_state(l_call)));
+  entry_state->transform(l_call, l_begin, *this, ns);
+
+  const bool summarize=
+    use_summaries && entry_state->supports_summaries();
+
+  // The state at the end of the function for an equal entry state.
+  // That entry state has been merged into the one at the beginning
+  // of the function before, hence there is nothing new to do.
+  const statet *summary=
+    summarize?find_summary(f_it->first, *entry_state):NULL;
+
   // This is the edge from call site to function head.
 
+  if(summary!=NULL)
+    summaries_reused++;
+  else
   {
-    // get the state at the beginning of the function
-    locationt l_begin=goto_function.body.instructions.begin();
     // initialize state, if necessary
     get_state(l_begin);
 
-    // do the edge from the call site to the beginning of the function
-    std::unique_ptr<statet> tmp_state(make_temporary_state(get_state(l_call)));
-    tmp_state->transform(l_call, l_begin, *this, ns);
-
     bool new_data=false;
 
     // merge the new stuff
-    if(merge(*tmp_state, l_call, l_begin))
+    if(merge(*entry_state, l_call, l_begin))
       new_data=true;
 
     // do we need to do/re-do the fixedpoint of the body?
@@ -377,8 +390,14 @@ bool ai_baset::do_function_call(
     locationt l_end=--goto_function.body.instructions.end();
     assert(l_end->is_end_function());
 
+    if(summary==NULL && summarize &&
+       unsummarized.find(f_it->first)==unsummarized.end())
+      summary=&add_summary(
+        f_it->first, std::move(entry_state), get_state(l_end));
+
     // do edge from end of function to instruction after call
-    std::unique_ptr<statet> tmp_state(make_temporary_state(get_state(l_end)));
+    std::unique_ptr<statet> tmp_state(
+      make_temporary_state(summary==NULL?get_state(l_end):*summary));
     tmp_state->transform(l_end, l_return, *this, ns);
 
     // Propagate those
@@ -416,6 +435,8 @@ bool ai_baset::do_function_call_rec(
     if(recursion_set.find(identifier)!=recursion_set.end())
     {
       // recursion detected!
+      // the functions being analysed miss the effect of this call
+      unsummarized.insert(recursion_set.begin(), recursion_set.end());
       return new_data;
     }
     else
@@ -484,6 +505,68 @@ bool ai_baset::do_function_call_rec(
 
 /*******************************************************************\
 
+Function: ai_baset::find_summary
+
+  Inputs: a function, and a state at its entry
+
+ Outputs: the state at the end of the function for an equal entry
+          state, or NULL if there is none
+
+ Purpose:
+
+\*******************************************************************/
+
+const ai_baset::statet *ai_baset::find_summary(
+  const irep_idt &function,
+  const statet &entry) const
+{
+  summariest::const_iterator s_it=summaries.find(function);
+
+  if(s_it==summaries.end())
+    return NULL;
+
+  for(const auto &summary : s_it->second)
+    if(summary.entry->is_equal(entry))
+      return summary.end.get();
+
+  return NULL;
+}
+
+/*******************************************************************\
+
+Function: ai_baset::add_summary
+
+  Inputs: a function, a state at its entry, and the resulting state
+          at its end
+
+ Outputs: the stored copy of the state at the end
+
+ Purpose: The state at the end includes the effect of all entry
+          states seen so far, which over-approximates the effect
+          of the given one.
+
+\*******************************************************************/
+
+const ai_baset::statet &ai_baset::add_summary(
+  const irep_idt &function,
+  std::unique_ptr<statet> entry,
+  const statet &end)
+{
+  summary_listt &summary_list=summaries[function];
+
+  if(summary_list.size()>=max_summaries)
+    summary_list.pop_front();
+
+  summary_list.push_back(summaryt());
+  summary_list.back().entry=std::move(entry);
+  summary_list.back().end=
+    std::unique_ptr<statet>(make_temporary_state(end));
+
+  return *summary_list.back().end;
+}
+
+/*******************************************************************\
+
 Function: ai_baset::sequential_fixedpoint
 
   Inputs:
@@ -9,7 +9,9 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_ANALYSES_AI_H
 #define CPROVER_ANALYSES_AI_H
 
+#include <list>
 #include <map>
+#include <memory>
 #include <iosfwd>
 
 #include <goto-programs/goto_model.h>
@@ -63,6 +65,20 @@ public:
   // a reasonable entry-point state
   virtual void make_entry()=0;
 
+  // Domains opt in to function summaries by returning true here,
+  // and by telling whether two of their states are equal. The
+  // effect of a function on a state at its entry is then reused
+  // when the function is called again with an equal state.
+  virtual bool supports_summaries() const
+  {
+    return false;
+  }
+
+  virtual bool is_equal(const ai_domain_baset &other) const
+  {
+    return false;
+  }
+
   // also add
   //
   //   bool merge(const T &b, locationt from, locationt to);
@@ -79,7 +95,7 @@ public:
   typedef ai_domain_baset statet;
   typedef goto_programt::const_targett locationt;
 
-  ai_baset()
+  ai_baset():use_summaries(false), summaries_reused(0)
   {
   }
 
@@ -126,8 +142,19 @@ public:
 
   virtual void clear()
   {
+    summaries.clear();
+    unsummarized.clear();
+    summaries_reused=0;
   }
 
+  // reuse the effect of functions, if the domain supports it;
+  // off by default
+  bool use_summaries;
+
+  // statistics: the calls that took the state of the callee from
+  // a summary
+  std::size_t summaries_reused;
+
   virtual void output(
     const namespacet &ns,
     const goto_functionst &goto_functions,
@@ -213,6 +240,31 @@ protected:
   typedef std::set<irep_idt> recursion_sett;
   recursion_sett recursion_set;
 
+  // The summaries of a function: states at its entry, and the state
+  // at its end that resulted. Functions whose analysis skipped a
+  // recursive call don't get summaries, as their end state may be
+  // incomplete.
+  struct summaryt
+  {
+    std::unique_ptr<statet> entry, end;
+  };
+
+  typedef std::list<summaryt> summary_listt;
+  typedef std::map<irep_idt, summary_listt> summariest;
+  summariest summaries;
+  recursion_sett unsummarized;
+
+  // the most recent summaries kept per function
+  static const std::size_t max_summaries=32;
+
+  const statet *find_summary(
+    const irep_idt &function,
+    const statet &entry) const;
+  const statet &add_summary(
+    const irep_idt &function,
+    std::unique_ptr<statet> entry,
+    const statet &end);
+
   // function calls
   bool do_function_call_rec(
     locationt l_call, locationt l_return,
@@ -341,6 +393,8 @@ public:
   // constructor
   concurrency_aware_ait():ait<domainT>()
   {
+    // the shared state may change the effect of a function
+    this->use_summaries=false;
   }
 
   bool merge_shared(
@@ -501,6 +501,31 @@ bool constant_propagator_domaint::merge(
 
 /*******************************************************************\
 
+Function: constant_propagator_domaint::is_equal
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bool constant_propagator_domaint::is_equal(
+  const ai_domain_baset &other) const
+{
+  const valuest &other_values=
+    static_cast<const constant_propagator_domaint &>(other).values;
+
+  return values.is_bottom==other_values.is_bottom &&
+         values.replace_const.expr_map==
+           other_values.replace_const.expr_map &&
+         values.replace_const.type_map==
+           other_values.replace_const.type_map;
+}
+
+/*******************************************************************\
+
 Function: constant_propagator_ait::replace
 
   Inputs:
@@ -30,6 +30,9 @@ public:
   void make_entry() final { values.set_to_top(); }
   bool merge(const constant_propagator_domaint &, locationt, locationt);
 
+  bool supports_summaries() const final { return true; }
+  bool is_equal(const ai_domain_baset &) const final;
+
   struct valuest
   {
   public:
@@ -102,8 +105,10 @@ class constant_propagator_ait:public ait<constant_propagator_domaint>
 public:
   constant_propagator_ait(
     goto_functionst &goto_functions,
-    const namespacet &ns)
+    const namespacet &ns,
+    bool _use_summaries=false)
   {
+    use_summaries=_use_summaries;
     operator()(goto_functions, ns);
     replace(goto_functions, ns);
   }
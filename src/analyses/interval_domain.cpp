@@ -129,6 +129,27 @@ void interval_domaint::transform(
 
 /*******************************************************************\
 
+Function: interval_domaint::is_equal
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bool interval_domaint::is_equal(const ai_domain_baset &other) const
+{
+  const interval_domaint &b=static_cast<const interval_domaint &>(other);
+
+  return bottom==b.bottom &&
+         int_map==b.int_map &&
+         float_map==b.float_map;
+}
+
+/*******************************************************************\
+
 Function: interval_domaint::merge
 
   Inputs:
@@ -45,6 +45,13 @@ public:
     locationt from,
     locationt to);
 
+  bool supports_summaries() const final
+  {
+    return true;
+  }
+
+  bool is_equal(const ai_domain_baset &other) const final;
+
   // no states
   void make_bottom() final
   {
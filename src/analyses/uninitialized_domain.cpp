@@ -138,3 +138,24 @@ bool uninitialized_domaint::merge(
 
   return changed;
 }
+
+/*******************************************************************\
+
+Function: uninitialized_domaint::is_equal
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bool uninitialized_domaint::is_equal(const ai_domain_baset &other) const
+{
+  const uninitialized_domaint &b=
+    static_cast<const uninitialized_domaint &>(other);
+
+  return has_values==b.has_values &&
+         uninitialized==b.uninitialized;
+}
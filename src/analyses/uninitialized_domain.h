@@ -60,6 +60,13 @@ public:
     locationt from,
     locationt to);
 
+  bool supports_summaries() const final
+  {
+    return true;
+  }
+
+  bool is_equal(const ai_domain_baset &other) const final;
+
 private:
   tvt has_values;
 
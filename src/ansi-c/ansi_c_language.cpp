@@ -99,9 +99,6 @@ bool ansi_c_languaget::parse(
   std::istream &instream,
   const std::string &path)
 {
-  // store the path
-  parse_path=path;
-
   // preprocessing
   std::ostringstream o_preprocessed;
 
@@ -110,6 +107,28 @@ bool ansi_c_languaget::parse(
 
   std::istringstream i_preprocessed(o_preprocessed.str());
 
+  return parse_preprocessed(i_preprocessed, path);
+}
+
+/*******************************************************************\
+
+Function: ansi_c_languaget::parse_preprocessed
+
+  Inputs: the output of preprocess, and the path of the source file
+
+ Outputs: true on error
+
+ Purpose:
+
+\*******************************************************************/
+
+bool ansi_c_languaget::parse_preprocessed(
+  std::istream &instream,
+  const std::string &path)
+{
+  // store the path
+  parse_path=path;
+
   // parsing
 
   std::string code;
@@ -133,7 +152,7 @@ bool ansi_c_languaget::parse(
   {
     ansi_c_parser.set_line_no(0);
     ansi_c_parser.set_file(path);
-    ansi_c_parser.in=&i_preprocessed;
+    ansi_c_parser.in=&instream;
     ansi_c_scanner_init();
     result=ansi_c_parser.parse();
   }
@@ -6,7 +6,9 @@ Author: Daniel Kroening, kroening@kroening.com
 
 \*******************************************************************/
 
+#include <algorithm>
 #include <iostream>
+#include <thread>
 
 #include <util/time_stopping.h>
 #include <util/xml.h>
@@ -63,27 +65,19 @@ void bmc_all_propertiest::goal_covered(const cover_goalst::goalt &)
 
 /*******************************************************************\
 
-Function: bmc_all_propertiest::operator()
+Function: bmc_all_propertiest::collect_goals
 
   Inputs:
 
  Outputs:
 
- Purpose:
+ Purpose: fill goal_map with the properties and their instances
+          in the equation
 
 \*******************************************************************/
 
-safety_checkert::resultt bmc_all_propertiest::operator()()
+void bmc_all_propertiest::collect_goals()
 {
-  status() << "Passing problem to " << solver.decision_procedure_text() << eom;
-
-  solver.set_message_handler(get_message_handler());
-
-  // stop the time
-  absolute_timet sat_start=current_time();
-
-  bmc.do_conversion();
-
   // Collect _all_ goals in `goal_map'.
   // This maps property IDs to 'goalt'
   forall_goto_functions(f_it, goto_functions)
@@ -110,7 +104,7 @@ safety_checkert::resultt bmc_all_propertiest::operator()()
         property_id=id2string(
           it->source.pc->source_location.get_function())+".unwind."+
           std::to_string(it->source.pc->loop_number);
-        goal_map[property_id].description=it->comment;
+        goal_map[property_id].description=id2string(it->comment);
       }
       else
         continue;
@@ -118,6 +112,32 @@ safety_checkert::resultt bmc_all_propertiest::operator()()
       goal_map[property_id].instances.push_back(it);
     }
   }
+}
+
+/*******************************************************************\
+
+Function: bmc_all_propertiest::operator()
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+safety_checkert::resultt bmc_all_propertiest::operator()()
+{
+  status() << "Passing problem to " << solver.decision_procedure_text() << eom;
+
+  solver.set_message_handler(get_message_handler());
+
+  // stop the time
+  absolute_timet sat_start=current_time();
+
+  bmc.do_conversion(solver);
+
+  collect_goals();
 
   do_before_solving();
 
@@ -191,6 +211,29 @@ Function: bmc_all_propertiest::report()
 \*******************************************************************/
 
 void bmc_all_propertiest::report(const cover_goalst &cover_goals)
+{
+  report_results(
+    cover_goals.number_covered(),
+    cover_goals.size(),
+    cover_goals.iterations());
+}
+
+/*******************************************************************\
+
+Function: bmc_all_propertiest::report_results
+
+  Inputs: number of failed goals, number of goals, solver iterations
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void bmc_all_propertiest::report_results(
+  std::size_t number_failed,
+  std::size_t number_goals,
+  unsigned iterations)
 {
   switch(bmc.ui)
   {
@@ -214,10 +257,10 @@ void bmc_all_propertiest::report(const cover_goalst &cover_goals)
           }
       }
 
-      status() << "\n** " << cover_goals.number_covered()
-               << " of " << cover_goals.size() << " failed ("
-               << cover_goals.iterations() << " iteration"
-               << (cover_goals.iterations()==1?"":"s")
+      status() << "\n** " << number_failed
+               << " of " << number_goals << " failed ("
+               << iterations << " iteration"
+               << (iterations==1?"":"s")
                << ")" << eom;
     }
     break;
@@ -263,6 +306,211 @@ void bmc_all_propertiest::report(const cover_goalst &cover_goals)
   }
 }
 
+/*******************************************************************\
+
+   Class: parallel_workert
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: the goals given to one solver thread, and what it found
+
+\*******************************************************************/
+
+struct parallel_workert
+{
+  bvt goals;
+
+  // one satisfying assignment per iteration that was SAT
+  std::vector<cnf_clause_list_assignmentt::assignmentt> assignments;
+
+  unsigned iterations;
+  propt::resultt result;
+
+  parallel_workert():iterations(0), result(propt::P_UNSATISFIABLE)
+  {
+  }
+};
+
+/*******************************************************************\
+
+Function: solve_goals
+
+  Inputs: clauses of the formula, the worker
+
+ Outputs:
+
+ Purpose: Covers the goals of the worker, as cover_goalst does,
+          on a solver of its own. This runs in a separate thread,
+          and must therefore not touch any irept, which are
+          not thread-safe.
+
+\*******************************************************************/
+
+static void solve_goals(
+  const cnf_clause_listt &cnf,
+  parallel_workert &worker)
+{
+  satcheck_no_simplifiert satcheck;
+  cnf.copy_to(satcheck);
+
+  std::vector<bool> covered(worker.goals.size(), false);
+
+  while(true)
+  {
+    // We want (at least) one of the remaining goals, please!
+    bvt clause;
+
+    for(std::size_t i=0; i<worker.goals.size(); i++)
+      if(!covered[i] && !worker.goals[i].is_false())
+        clause.push_back(worker.goals[i]);
+
+    if(clause.empty())
+    {
+      worker.result=propt::P_UNSATISFIABLE;
+      return;
+    }
+
+    worker.iterations++;
+    satcheck.lcnf(clause);
+
+    worker.result=satcheck.prop_solve();
+
+    if(worker.result!=propt::P_SATISFIABLE)
+      return;
+
+    for(std::size_t i=0; i<worker.goals.size(); i++)
+      if(!covered[i] && satcheck.l_get(worker.goals[i]).is_true())
+        covered[i]=true;
+
+    worker.assignments.push_back(
+      cnf_clause_list_assignmentt::assignmentt());
+    cnf_clause_list_assignmentt::assignmentt &assignment=
+      worker.assignments.back();
+
+    assignment.resize(cnf.no_variables());
+    for(unsigned v=1; v<assignment.size(); v++)
+      assignment[v]=satcheck.l_get(literalt(v, false));
+  }
+}
+
+/*******************************************************************\
+
+Function: bmc_all_properties_parallelt::operator()
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+safety_checkert::resultt bmc_all_properties_parallelt::operator()()
+{
+  status() << "Passing problem to " << workers << " solver threads" << eom;
+
+  solver.set_message_handler(get_message_handler());
+
+  // stop the time
+  absolute_timet sat_start=current_time();
+
+  bmc.do_conversion(solver);
+
+  collect_goals();
+
+  do_before_solving();
+
+  // the goals are dealt out round-robin
+  std::vector<parallel_workert> worker_data(
+    std::min<std::size_t>(workers, std::max<std::size_t>(goal_map.size(), 1)));
+  std::map<irep_idt, std::size_t> goal_worker;
+
+  std::size_t index=0;
+  for(const auto &g : goal_map)
+  {
+    std::size_t w=index++%worker_data.size();
+    goal_worker[g.first]=w;
+
+    // Our goal is to falsify a property, i.e., we will
+    // add the negation of the property as goal.
+    worker_data[w].goals.push_back(!solver.convert(g.second.as_expr()));
+  }
+
+  prop_conv_solver.finish_eager_conversion();
+
+  status() << "Running " << worker_data.size() << " solver threads on "
+           << cnf.no_variables() << " variables, "
+           << cnf.no_clauses() << " clauses" << eom;
+
+  std::vector<std::thread> threads;
+  threads.reserve(worker_data.size());
+
+  for(auto &w : worker_data)
+    threads.push_back(std::thread(solve_goals, std::cref(cnf), std::ref(w)));
+
+  for(auto &t : threads)
+    t.join();
+
+  // compute the traces from the satisfying assignments,
+  // as goal_covered does with the assignment of the solver
+  unsigned iterations=0;
+  bool error=false;
+
+  for(auto &w : worker_data)
+  {
+    iterations+=w.iterations;
+
+    if(w.result==propt::P_ERROR)
+    {
+      error=true;
+      messaget::error() << "decision procedure has failed" << eom;
+    }
+
+    for(auto &assignment : w.assignments)
+    {
+      cnf.get_assignment().swap(assignment);
+      goal_covered(cover_goalst::goalt());
+    }
+  }
+
+  std::size_t number_failed=0;
+
+  for(auto &g : goal_map)
+  {
+    if(g.second.status==goalt::statust::FAILURE)
+      number_failed++;
+    else if(worker_data[goal_worker[g.first]].result==propt::P_ERROR)
+      g.second.status=goalt::statust::ERROR;
+    else
+      g.second.status=goalt::statust::SUCCESS;
+  }
+
+  // output runtime
+
+  {
+    absolute_timet sat_stop=current_time();
+    status() << "Runtime decision procedure: "
+             << (sat_stop-sat_start) << "s" << eom;
+  }
+
+  // report
+  report_results(number_failed, goal_map.size(), iterations);
+
+  if(error)
+    return safety_checkert::ERROR;
+
+  bool safe=(number_failed==0);
+
+  if(safe)
+    bmc.report_success(); // legacy, might go away
+  else
+    bmc.report_failure(); // legacy, might go away
+
+  return safe?safety_checkert::SAFE:safety_checkert::UNSAFE;
+}
+
 /*******************************************************************\
 
 Function: bmct::all_properties
@@ -279,6 +527,31 @@ safety_checkert::resultt bmct::all_properties(
   const goto_functionst &goto_functions,
   prop_convt &solver)
 {
+  const unsigned workers=
+    options.get_unsigned_int_option("parallel-properties");
+
+  if(workers>1)
+  {
+    // we need to copy the formula, and thus need it in CNF
+    const bv_cbmct *bv_cbmc_solver=dynamic_cast<const bv_cbmct *>(&solver);
+
+    if(bv_cbmc_solver!=NULL)
+    {
+      cnf_clause_list_assignmentt cnf;
+      cnf.set_message_handler(get_message_handler());
+      bv_cbmct bv_cbmc(ns, cnf);
+      bv_cbmc.unbounded_array=bv_cbmc_solver->unbounded_array;
+
+      bmc_all_properties_parallelt bmc_all_properties(
+        goto_functions, bv_cbmc, cnf, *this, workers);
+      bmc_all_properties.set_message_handler(get_message_handler());
+      return bmc_all_properties();
+    }
+
+    warning() << "--parallel-properties requires the default SAT solver"
+              << eom;
+  }
+
   bmc_all_propertiest bmc_all_properties(goto_functions, solver, *this);
   bmc_all_properties.set_message_handler(get_message_handler());
   return bmc_all_properties();
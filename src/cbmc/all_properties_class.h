@@ -10,6 +10,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #define CPROVER_CBMC_ALL_PROPERTIES_CLASS_H
 
 #include <solvers/prop/cover_goals.h>
+#include <solvers/sat/cnf_clause_list.h>
 
 #include "bmc.h"
 
@@ -98,8 +99,52 @@ protected:
   prop_convt &solver;
   bmct &bmc;
 
+  void collect_goals();
+
   virtual void report(const cover_goalst &cover_goals);
+  void report_results(
+    std::size_t number_failed,
+    std::size_t number_goals,
+    unsigned iterations);
   virtual void do_before_solving() {}
 };
 
+/*******************************************************************\
+
+   Class: bmc_all_properties_parallelt
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Checks the goals on several SAT solvers running in
+          separate threads. The formula is converted once into
+          a clause list, which each of the solvers gets a copy of.
+
+\*******************************************************************/
+
+class bmc_all_properties_parallelt:public bmc_all_propertiest
+{
+public:
+  bmc_all_properties_parallelt(
+    const goto_functionst &_goto_functions,
+    prop_conv_solvert &_solver,
+    cnf_clause_list_assignmentt &_cnf,
+    bmct &_bmc,
+    unsigned _workers):
+    bmc_all_propertiest(_goto_functions, _solver, _bmc),
+    prop_conv_solver(_solver),
+    cnf(_cnf),
+    workers(_workers)
+  {
+  }
+
+  safety_checkert::resultt operator()();
+
+protected:
+  prop_conv_solvert &prop_conv_solver;
+  cnf_clause_list_assignmentt &cnf;
+  unsigned workers;
+};
+
 #endif // CPROVER_CBMC_ALL_PROPERTIES_CLASS_H
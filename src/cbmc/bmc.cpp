@@ -60,7 +60,7 @@ void bmct::do_unwind_module()
 
 Function: bmct::error_trace
 
-  Inputs:
+  Inputs: the solver with the satisfying assignment
 
  Outputs:
 
@@ -68,12 +68,12 @@ Function: bmct::error_trace
 
 \*******************************************************************/
 
-void bmct::error_trace()
+void bmct::error_trace(const prop_convt &solver)
 {
   status() << "Building error trace" << eom;
 
   goto_tracet &goto_trace=safety_checkert::error_trace;
-  build_goto_trace(equation, prop_conv, ns, goto_trace);
+  build_goto_trace(equation, solver, ns, goto_trace);
 
   switch(ui)
   {
@@ -150,7 +150,7 @@ void bmct::output_graphml(
 
 Function: bmct::do_conversion
 
-  Inputs:
+  Inputs: the decision procedure to convert into
 
  Outputs:
 
@@ -158,7 +158,7 @@ Function: bmct::do_conversion
 
 \*******************************************************************/
 
-void bmct::do_conversion()
+void bmct::do_conversion(prop_convt &solver)
 {
   // convert HDL (hook for hw-cbmc)
   do_unwind_module();
@@ -166,7 +166,7 @@ void bmct::do_conversion()
   status() << "converting SSA" << eom;
 
   // convert SSA
-  equation.convert(prop_conv);
+  equation.convert(solver);
 
   // the 'extra constraints'
   if(!bmc_constraints.empty())
@@ -174,7 +174,7 @@ void bmct::do_conversion()
     status() << "converting constraints" << eom;
 
     forall_expr_list(it, bmc_constraints)
-      prop_conv.set_to_true(*it);
+      solver.set_to_true(*it);
   }
 }
 
@@ -442,6 +442,58 @@ safety_checkert::resultt bmct::run(
 
   symex.last_source_location.make_nil();
 
+  if(options.get_bool_option("incremental"))
+  {
+    if(options.get_option("unwind")!="")
+    {
+      error() << "--incremental chooses the bound itself, "
+              << "use --unwind-min and --unwind-max instead of --unwind"
+              << eom;
+      return safety_checkert::ERROR;
+    }
+
+    // these aren't implemented by incremental unwinding
+    if(!options.get_list_option("cover").empty() ||
+       options.get_bool_option("show-vcc") ||
+       options.get_bool_option("program-only") ||
+       options.get_bool_option("localize-faults") ||
+       options.get_bool_option("stream-conversion") ||
+       options.get_option("cube-and-conquer")!="" ||
+       options.get_option("parallel-properties")!="" ||
+       options.get_option("slice-by-trace")!="")
+    {
+      error() << "--incremental is not supported with "
+              << "this combination of options" << eom;
+      return safety_checkert::ERROR;
+    }
+
+    return incremental_unwinding(goto_functions);
+  }
+
+  const bool stream_conversion=
+    options.get_bool_option("stream-conversion");
+
+  if(stream_conversion)
+  {
+    // these need the expressions that are dropped when streaming
+    if(!options.get_list_option("cover").empty() ||
+       options.get_bool_option("show-vcc") ||
+       options.get_bool_option("program-only") ||
+       options.get_option("localize-faults")!="" ||
+       options.get_option("cube-and-conquer")!="" ||
+       options.get_option("parallel-properties")!="" ||
+       options.get_option("slice-by-trace")!="" ||
+       options.get_option("graphml-witness")!="")
+    {
+      error() << "--stream-conversion is not supported with "
+              << "this combination of options" << eom;
+      return safety_checkert::ERROR;
+    }
+
+    prop_conv.set_message_handler(get_message_handler());
+    equation.set_stream_converter(prop_conv);
+  }
+
   try
   {
     // get unwinding info
@@ -453,6 +505,12 @@ safety_checkert::resultt bmct::run(
     // add a partial ordering, if required
     if(equation.has_threads())
     {
+      if(stream_conversion)
+      {
+        error() << "--stream-conversion does not support threads" << eom;
+        return safety_checkert::ERROR;
+      }
+
       memory_model->set_message_handler(get_message_handler());
       (*memory_model)(equation);
     }
@@ -501,6 +559,11 @@ safety_checkert::resultt bmct::run(
       // we should build a thread-aware SSA slicer
       statistics() << "no slicing due to threads" << eom;
     }
+    else if(stream_conversion)
+    {
+      // the steps have been converted already
+      statistics() << "no slicing with streaming conversion" << eom;
+    }
     else
     {
       if(options.get_bool_option("slice-formula"))
@@ -526,6 +589,10 @@ safety_checkert::resultt bmct::run(
       statistics() << "Generated " << symex.total_vccs
                    << " VCC(s), " << symex.remaining_vccs
                    << " remaining after simplification" << eom;
+
+      debug() << "Simplifier cache: " << symex.simplify_cache.hits
+              << " hits, " << symex.simplify_cache.misses
+              << " misses" << eom;
     }
 
     // coverage report
@@ -614,7 +681,12 @@ safety_checkert::resultt bmct::decide(
   prop_conv.set_message_handler(get_message_handler());
 
   if(options.get_bool_option("stop-on-fail"))
+  {
+    if(options.get_option("cube-and-conquer")!="")
+      return cube_and_conquer(goto_functions);
+
     return stop_on_fail(goto_functions, prop_conv);
+  }
   else
     return all_properties(goto_functions, prop_conv);
 }
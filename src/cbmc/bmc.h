@@ -83,7 +83,8 @@ protected:
   // unwinding
   virtual void setup_unwind();
   virtual void do_unwind_module();
-  void do_conversion();
+  void do_conversion() { do_conversion(prop_conv); }
+  void do_conversion(prop_convt &solver);
 
   virtual void show_vcc();
   virtual void show_vcc_plain(std::ostream &out);
@@ -95,11 +96,20 @@ protected:
   virtual resultt stop_on_fail(
     const goto_functionst &goto_functions,
     prop_convt &solver);
+  virtual resultt incremental_unwinding(
+    const goto_functionst &goto_functions);
+  bool incremental_symex(
+    const goto_functionst &goto_functions,
+    unsigned unwind,
+    bool last);
+  virtual resultt cube_and_conquer(
+    const goto_functionst &goto_functions);
   virtual void show_program();
   virtual void report_success();
   virtual void report_failure();
 
-  virtual void error_trace();
+  void error_trace() { error_trace(prop_conv); }
+  virtual void error_trace(const prop_convt &solver);
   void output_graphml(
     resultt result,
     const goto_functionst &goto_functions);
@@ -109,6 +119,7 @@ protected:
     const optionst::value_listt &criteria);
 
   friend class bmc_all_propertiest;
+  friend class bmc_all_properties_parallelt;
   friend class bmc_covert;
   friend class fault_localizationt;
 };
@@ -0,0 +1,300 @@
+/*******************************************************************\
+
+Module: Cube and Conquer for a Single Verification Condition
+
+Author:
+
+\*******************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include <util/time_stopping.h>
+
+#include <solvers/sat/cnf_clause_list.h>
+
+#include "bv_cbmc.h"
+#include "bmc.h"
+
+/*******************************************************************\
+
+   Class: cube_and_conquer_statet
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: the cubes, and what the solver threads found
+
+\*******************************************************************/
+
+class cube_and_conquer_statet
+{
+public:
+  cube_and_conquer_statet(
+    const cnf_clause_listt &_cnf,
+    const std::vector<bvt> &_cubes,
+    std::size_t workers):
+    cnf(_cnf),
+    cubes(_cubes),
+    next_cube(0),
+    running(workers),
+    solvers(workers, NULL),
+    satisfiable(false),
+    error(false),
+    satisfiable_cube(0)
+  {
+  }
+
+  const cnf_clause_listt &cnf;
+  const std::vector<bvt> &cubes;
+
+  std::mutex mutex;
+  std::condition_variable finished_cond;
+
+  std::size_t next_cube;
+  std::size_t running;
+
+  // the solvers of the threads, for interrupting them
+  std::vector<propt *> solvers;
+
+  bool satisfiable, error;
+  std::size_t satisfiable_cube;
+  cnf_clause_list_assignmentt::assignmentt assignment;
+};
+
+/*******************************************************************\
+
+Function: solve_cubes
+
+  Inputs: the shared state, the index of the thread
+
+ Outputs:
+
+ Purpose: Solves cubes on a solver of its own until there are no
+          more, or one is satisfiable. This runs in a separate
+          thread, and must therefore not touch any irept, which
+          are not thread-safe.
+
+\*******************************************************************/
+
+static void solve_cubes(
+  cube_and_conquer_statet &state,
+  std::size_t worker)
+{
+  satcheck_no_simplifiert satcheck;
+  state.cnf.copy_to(satcheck);
+
+  std::unique_lock<std::mutex> lock(state.mutex);
+  state.solvers[worker]=&satcheck;
+
+  while(!state.satisfiable &&
+        !state.error &&
+        state.next_cube<state.cubes.size())
+  {
+    const std::size_t cube=state.next_cube++;
+
+    lock.unlock();
+
+    satcheck.set_assumptions(state.cubes[cube]);
+    propt::resultt result=satcheck.prop_solve();
+
+    lock.lock();
+
+    if(state.satisfiable)
+      break;
+
+    if(result==propt::P_SATISFIABLE)
+    {
+      state.satisfiable=true;
+      state.satisfiable_cube=cube;
+
+      state.assignment.resize(state.cnf.no_variables());
+      for(unsigned v=1; v<state.assignment.size(); v++)
+        state.assignment[v]=satcheck.l_get(literalt(v, false));
+    }
+    else if(result==propt::P_ERROR)
+      state.error=true;
+  }
+
+  state.solvers[worker]=NULL;
+  state.running--;
+  state.finished_cond.notify_all();
+}
+
+/*******************************************************************\
+
+Function: split_literals
+
+  Inputs: the converted equation, the number of literals wanted
+
+ Outputs: the literals to split on
+
+ Purpose: Picks the conditions of the branches that are reached
+          unconditionally, and then those of the other branches,
+          in the order symex took them.
+
+\*******************************************************************/
+
+static void split_literals(
+  const symex_target_equationt &equation,
+  std::size_t max,
+  bvt &dest)
+{
+  std::set<unsigned> variables;
+
+  for(unsigned pass=0; pass<2; pass++)
+  {
+    for(const auto &step : equation.SSA_steps)
+    {
+      if(dest.size()>=max)
+        return;
+
+      if(!step.is_goto() ||
+         step.ignore ||
+         step.cond_literal.is_constant() ||
+         step.guard_literal.is_false() ||
+         step.guard.is_true()!=(pass==0))
+        continue;
+
+      if(variables.insert(step.cond_literal.var_no()).second)
+        dest.push_back(step.cond_literal);
+    }
+  }
+}
+
+/*******************************************************************\
+
+Function: bmct::cube_and_conquer
+
+  Inputs: goto functions
+
+ Outputs: verification result
+
+ Purpose: Splits the formula on the conditions of a few branches,
+          and solves the resulting cubes as assumptions on copies
+          of the formula, in parallel. Stops when a cube is
+          satisfiable.
+
+\*******************************************************************/
+
+safety_checkert::resultt bmct::cube_and_conquer(
+  const goto_functionst &goto_functions)
+{
+  // we need to copy the formula, and thus need it in CNF
+  const bv_cbmct *bv_cbmc_solver=dynamic_cast<const bv_cbmct *>(&prop_conv);
+
+  if(bv_cbmc_solver==NULL ||
+     options.get_bool_option("dimacs") ||
+     options.get_option("outfile")!="")
+  {
+    warning() << "--cube-and-conquer requires the default SAT solver"
+              << eom;
+    return stop_on_fail(goto_functions, prop_conv);
+  }
+
+  const unsigned workers=
+    std::max(options.get_unsigned_int_option("cube-and-conquer"), 1u);
+
+  cnf_clause_list_assignmentt cnf;
+  cnf.set_message_handler(get_message_handler());
+  bv_cbmct bv_cbmc(ns, cnf);
+  bv_cbmc.unbounded_array=bv_cbmc_solver->unbounded_array;
+
+  status() << "Passing problem to " << workers << " solver threads" << eom;
+
+  // stop the time
+  absolute_timet sat_start=current_time();
+
+  do_conversion(bv_cbmc);
+
+  bv_cbmc.finish_eager_conversion();
+
+  // There are four times as many cubes as threads,
+  // as some of them will be much easier than others.
+  std::size_t number_of_literals=0;
+  while((std::size_t(1)<<number_of_literals)<4*workers)
+    number_of_literals++;
+
+  bvt split;
+  split_literals(equation, number_of_literals, split);
+
+  std::vector<bvt> cubes(std::size_t(1)<<split.size());
+
+  for(std::size_t i=0; i<cubes.size(); i++)
+    for(std::size_t j=0; j<split.size(); j++)
+      cubes[i].push_back(split[j]^(((i>>j)&1)!=0));
+
+  status() << "Running " << workers << " solver threads on "
+           << cubes.size() << " cubes over "
+           << cnf.no_variables() << " variables, "
+           << cnf.no_clauses() << " clauses" << eom;
+
+  cube_and_conquer_statet state(cnf, cubes, workers);
+
+  std::vector<std::thread> threads;
+  threads.reserve(workers);
+
+  for(std::size_t i=0; i<workers; i++)
+    threads.push_back(std::thread(solve_cubes, std::ref(state), i));
+
+  {
+    std::unique_lock<std::mutex> lock(state.mutex);
+
+    while(!state.satisfiable && !state.error && state.running!=0)
+      state.finished_cond.wait(lock);
+
+    // A solver that is just starting may miss the interrupt,
+    // hence we repeat it until all threads have stopped.
+    while(state.running!=0)
+    {
+      for(auto solver : state.solvers)
+        if(solver!=NULL)
+          solver->interrupt();
+
+      state.finished_cond.wait_for(lock, std::chrono::milliseconds(10));
+    }
+  }
+
+  for(auto &t : threads)
+    t.join();
+
+  // output runtime
+
+  {
+    absolute_timet sat_stop=current_time();
+    status() << "Runtime decision procedure: "
+             << (sat_stop-sat_start) << "s" << eom;
+  }
+
+  if(state.satisfiable)
+  {
+    status() << "Cube " << (state.satisfiable_cube+1) << " of "
+             << cubes.size() << " is satisfiable" << eom;
+
+    cnf.get_assignment().swap(state.assignment);
+
+    if(options.get_bool_option("trace"))
+    {
+      error_trace(bv_cbmc);
+      output_graphml(UNSAFE, goto_functions);
+    }
+
+    report_failure();
+    return UNSAFE;
+  }
+
+  if(state.error)
+  {
+    error() << "decision procedure failed" << eom;
+    return ERROR;
+  }
+
+  report_success();
+  output_graphml(SAFE, goto_functions);
+  return SAFE;
+}
@@ -0,0 +1,290 @@
+/*******************************************************************\
+
+Module: Incremental Bounded Model Checking for ANSI-C
+
+Author:
+
+\*******************************************************************/
+
+#include <util/std_expr.h>
+
+#include <solvers/prop/literal_expr.h>
+
+#include "bmc.h"
+
+/*******************************************************************\
+
+Function: is_unwinding_assertion
+
+  Inputs: SSA step
+
+ Outputs: true iff the step is an unwinding assertion
+
+ Purpose: symex places unwinding assertions at the backwards goto
+          or the function call that exceeds the bound
+
+\*******************************************************************/
+
+static bool is_unwinding_assertion(
+  const symex_target_equationt::SSA_stept &step)
+{
+  return step.is_assert() && !step.source.pc->is_assert();
+}
+
+/*******************************************************************\
+
+Function: bmct::incremental_symex
+
+  Inputs: goto functions, unwinding bound, whether this is the
+          largest bound to be tried
+
+ Outputs: true on error
+
+ Purpose: run symex from scratch for the given unwinding bound
+
+\*******************************************************************/
+
+bool bmct::incremental_symex(
+  const goto_functionst &goto_functions,
+  unsigned unwind,
+  bool last)
+{
+  status() << "Unwinding loops " << unwind << " times" << eom;
+
+  // Below the largest bound, we record paths that exceed the bound
+  // as unwinding assertions, which are checked separately.
+  symex.options=options;
+  if(!last)
+  {
+    symex.options.set_option("unwinding-assertions", true);
+    symex.options.set_option("partial-loops", false);
+  }
+
+  symex.set_unwind_limit(unwind);
+
+  // symex is deterministic when started afresh, hence all steps
+  // before the first unwinding assertion are the same as those
+  // obtained with the previous bound
+  equation.clear();
+  new_symbol_table.clear();
+  symex.reset_counters();
+  symex.last_source_location.make_nil();
+
+  try
+  {
+    symex(goto_functions);
+  }
+
+  catch(const std::string &error_str)
+  {
+    messaget message(get_message_handler());
+    message.error().source_location=symex.last_source_location;
+    message.error() << error_str << messaget::eom;
+
+    return true;
+  }
+
+  catch(const char *error_str)
+  {
+    messaget message(get_message_handler());
+    message.error().source_location=symex.last_source_location;
+    message.error() << error_str << messaget::eom;
+
+    return true;
+  }
+
+  catch(std::bad_alloc)
+  {
+    error() << "Out of memory" << eom;
+    return true;
+  }
+
+  if(equation.has_threads())
+  {
+    error() << "incremental unwinding does not support threads" << eom;
+    return true;
+  }
+
+  statistics() << "size of program expression: "
+               << equation.SSA_steps.size()
+               << " steps" << eom;
+
+  statistics() << "Generated " << symex.total_vccs
+               << " VCC(s), " << symex.remaining_vccs
+               << " remaining after simplification" << eom;
+
+  debug() << "Simplifier cache: " << symex.simplify_cache.hits
+          << " hits, " << symex.simplify_cache.misses
+          << " misses" << eom;
+
+  return false;
+}
+
+/*******************************************************************\
+
+Function: bmct::incremental_unwinding
+
+  Inputs: goto functions
+
+ Outputs: verification result
+
+ Purpose: Increase the unwinding bound until a property fails,
+          the loops are unwound completely, or the maximum bound
+          is reached. The solver is kept, and the constraints that
+          do not depend on the bound are passed to it only once.
+          The remaining ones are made conditional on an activation
+          literal per bound.
+
+\*******************************************************************/
+
+safety_checkert::resultt bmct::incremental_unwinding(
+  const goto_functionst &goto_functions)
+{
+  prop_conv_solvert *solver=dynamic_cast<prop_conv_solvert *>(&prop_conv);
+
+  if(solver==NULL || !solver->has_set_assumptions())
+  {
+    error() << "incremental unwinding requires a SAT solver "
+            << "with support for assumptions" << eom;
+    return ERROR;
+  }
+
+  // without a limit, this wouldn't terminate for programs
+  // whose loops can't be unwound completely
+  unsigned unwind_min=1, unwind_max=100;
+
+  if(options.get_option("unwind-min")!="")
+    unwind_min=options.get_unsigned_int_option("unwind-min");
+  if(options.get_option("unwind-max")!="")
+    unwind_max=options.get_unsigned_int_option("unwind-max");
+
+  if(unwind_min>unwind_max)
+  {
+    error() << "--unwind-min must not exceed --unwind-max" << eom;
+    return ERROR;
+  }
+
+  solver->set_message_handler(get_message_handler());
+
+  // loop limits given by --unwindset still apply
+  setup_unwind();
+
+  // the number of SSA steps whose constraints the solver has
+  std::size_t converted=0;
+
+  for(unsigned unwind=unwind_min; ; unwind++)
+  {
+    const bool last=unwind>=unwind_max;
+
+    if(incremental_symex(goto_functions, unwind, last))
+      return ERROR;
+
+    std::size_t permanent=0;
+
+    for(const auto &step : equation.SSA_steps)
+    {
+      if(!last && is_unwinding_assertion(step))
+        break;
+      permanent++;
+    }
+
+    literalt activation=solver->convert(
+      symbol_exprt(
+        "bmc::unwind_activation"+std::to_string(unwind),
+        bool_typet()));
+
+    status() << "converting SSA" << eom;
+
+    equation.convert_incremental(*solver, converted, permanent, activation);
+    converted=permanent;
+
+    // as in symex_target_equationt::convert_assertions, but
+    // unwinding assertions are kept apart from the properties
+    or_exprt::operandst properties, unwindings;
+    exprt assumption=true_exprt();
+
+    for(auto &step : equation.SSA_steps)
+    {
+      if(step.is_assert())
+      {
+        step.cond_literal=
+          solver->convert(implies_exprt(assumption, step.cond_expr));
+
+        if(!last && is_unwinding_assertion(step))
+          unwindings.push_back(literal_exprt(!step.cond_literal));
+        else
+          properties.push_back(literal_exprt(!step.cond_literal));
+      }
+      else if(step.is_assume())
+      {
+        if(assumption.id()==ID_and)
+          assumption.copy_to_operands(literal_exprt(step.cond_literal));
+        else
+          assumption=
+            and_exprt(assumption, literal_exprt(step.cond_literal));
+      }
+    }
+
+    bvt assumptions;
+    assumptions.push_back(
+      solver->convert(
+        and_exprt(literal_exprt(activation), disjunction(properties))));
+    solver->set_assumptions(assumptions);
+    solver->redo_post_processing();
+
+    status() << "Running " << solver->decision_procedure_text() << eom;
+
+    switch(solver->dec_solve())
+    {
+    case decision_proceduret::D_SATISFIABLE:
+      if(options.get_bool_option("trace"))
+      {
+        error_trace();
+        output_graphml(UNSAFE, goto_functions);
+      }
+
+      report_failure();
+      return UNSAFE;
+
+    case decision_proceduret::D_UNSATISFIABLE:
+      break;
+
+    default:
+      error() << "decision procedure failed" << eom;
+      return ERROR;
+    }
+
+    if(last || unwindings.empty())
+    {
+      report_success();
+      output_graphml(SAFE, goto_functions);
+      return SAFE;
+    }
+
+    // can any path exceed the bound?
+    assumptions.front()=
+      solver->convert(
+        and_exprt(literal_exprt(activation), disjunction(unwindings)));
+    solver->set_assumptions(assumptions);
+
+    switch(solver->dec_solve())
+    {
+    case decision_proceduret::D_SATISFIABLE:
+      break;
+
+    case decision_proceduret::D_UNSATISFIABLE:
+      status() << "Loops are unwound completely" << eom;
+      report_success();
+      output_graphml(SAFE, goto_functions);
+      return SAFE;
+
+    default:
+      error() << "decision procedure failed" << eom;
+      return ERROR;
+    }
+
+    // the constraints of this bound are not needed anymore
+    solver->set_assumptions(bvt());
+    solver->set_to_false(literal_exprt(activation));
+  }
+}
@@ -33,6 +33,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <goto-programs/show_properties.h>
 #include <goto-programs/set_properties.h>
 #include <goto-programs/read_goto_binary.h>
+#include <goto-programs/lazy_goto_binary.h>
 #include <goto-programs/string_abstraction.h>
 #include <goto-programs/string_instrumentation.h>
 #include <goto-programs/loop_ids.h>
@@ -184,7 +185,8 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
 
   if(cmdline.isset("stop-on-fail") ||
      cmdline.isset("dimacs") ||
-     cmdline.isset("outfile"))
+     cmdline.isset("outfile") ||
+     cmdline.isset("cube-and-conquer"))
     options.set_option("stop-on-fail", true);
   else
     options.set_option("stop-on-fail", false);
@@ -193,6 +195,14 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
      cmdline.isset("stop-on-fail"))
     options.set_option("trace", true);
 
+  if(cmdline.isset("parallel-properties"))
+    options.set_option(
+      "parallel-properties", cmdline.get_value("parallel-properties"));
+
+  if(cmdline.isset("cube-and-conquer"))
+    options.set_option(
+      "cube-and-conquer", cmdline.get_value("cube-and-conquer"));
+
   if(cmdline.isset("localize-faults"))
     options.set_option("localize-faults", true);
   if(cmdline.isset("localize-faults-method"))
@@ -217,6 +227,27 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
   if(cmdline.isset("unwindset"))
     options.set_option("unwindset", cmdline.get_value("unwindset"));
 
+  // incremental unwinding
+  if(cmdline.isset("incremental"))
+  {
+    // it stops at the first property that fails
+    if(cmdline.isset("all-properties") ||
+       cmdline.isset("all-claims"))
+    {
+      error() << "--incremental and --all-properties "
+              << "must not be given together" << eom;
+      exit(1); // should contemplate EX_USAGE from sysexits.h
+    }
+
+    options.set_option("incremental", true);
+  }
+
+  if(cmdline.isset("unwind-min"))
+    options.set_option("unwind-min", cmdline.get_value("unwind-min"));
+
+  if(cmdline.isset("unwind-max"))
+    options.set_option("unwind-max", cmdline.get_value("unwind-max"));
+
   // constant propagation
   if(cmdline.isset("no-propagation"))
     options.set_option("propagation", false);
@@ -269,6 +300,16 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
     exit(1); // should contemplate EX_USAGE from sysexits.h
   }
 
+  // keep the guards canonical using BDDs
+  options.set_option(
+    "bdd-guards",
+    cmdline.isset("bdd-guards"));
+
+  // convert the steps while they are generated
+  options.set_option(
+    "stream-conversion",
+    cmdline.isset("stream-conversion"));
+
   // remove unused equations
   options.set_option(
     "slice-formula",
@@ -317,6 +358,9 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
   if(cmdline.isset("aig"))
     options.set_option("aig", true);
 
+  if(cmdline.isset("sat-portfolio"))
+    options.set_option("sat-portfolio", true);
+
   // SMT Options
   bool version_set=false;
 
@@ -713,15 +757,36 @@ int cbmc_parse_optionst::get_goto_program(
       clear_parse();
     }
 
-    for(const auto &bin : binaries)
+    // A single goto binary is read directly, loading only the
+    // function bodies that may be reached from the entry point,
+    // unless we are asked to show all functions, loops or properties.
+    if(binaries.size()==1 &&
+       cmdline.args.empty() &&
+       !cmdline.isset("function") &&
+       !cmdline.isset("show-goto-functions") &&
+       !cmdline.isset("show-loops") &&
+       !cmdline.isset("show-claims") &&
+       !cmdline.isset("show-properties") &&
+       !cmdline.isset("cover"))
     {
       status() << "Reading GOTO program from file " << eom;
 
-      if(read_object_and_link(
-        bin,
-        symbol_table,
-        goto_functions,
-        get_message_handler()))
+      lazy_goto_binaryt lazy_goto_binary(
+        symbol_table, goto_functions, get_message_handler());
+
+      if(lazy_goto_binary.read(binaries.front()) ||
+         lazy_goto_binary.load_reachable(goto_functionst::entry_point()))
+        return 6;
+    }
+    else if(!binaries.empty())
+    {
+      status() << "Reading GOTO program from file " << eom;
+
+      if(read_objects_and_link(
+           binaries,
+           symbol_table,
+           goto_functions,
+           get_message_handler()))
       {
         return 6;
       }
@@ -738,7 +803,11 @@ int cbmc_parse_optionst::get_goto_program(
 
     status() << "Generating GOTO Program" << eom;
 
-    goto_convert(symbol_table, goto_functions, ui_message_handler);
+    unsigned workers=1;
+    if(cmdline.isset("parallel-conversion"))
+      workers=unsafe_string2unsigned(cmdline.get_value("parallel-conversion"));
+
+    goto_convert(symbol_table, goto_functions, ui_message_handler, workers);
 
     if(process_goto_program(options, goto_functions))
       return 6;
@@ -1094,6 +1163,9 @@ void cbmc_parse_optionst::help()
     " --symex-coverage-report f    generate a Cobertura XML coverage report in f\n" // NOLINT(*)
     " --property id                only check one specific property\n"
     " --stop-on-fail               stop analysis once a failed property is detected\n" // NOLINT(*)
+    " --parallel-properties n      check the properties with n solver threads\n" // NOLINT(*)
+    " --cube-and-conquer n         split the formula into cubes, and solve\n"
+    "                              these with n solver threads\n"
     " --trace                      give a counterexample trace for failed properties\n" //NOLINT(*)
     "\n"
     "C/C++ frontend options:\n"
@@ -1140,6 +1212,7 @@ void cbmc_parse_optionst::help()
     " --show-parse-tree            show parse tree\n"
     " --show-symbol-table          show symbol table\n"
     HELP_SHOW_GOTO_FUNCTIONS
+    " --parallel-conversion n      generate the GOTO program with n processes\n" // NOLINT(*)
     "\n"
     "Program instrumentation options:\n"
     HELP_GOTO_CHECK
@@ -1156,6 +1229,10 @@ void cbmc_parse_optionst::help()
     " --java-max-vla-length        limit the length of user-code-created arrays\n"
     // NOLINTNEXTLINE(whitespace/line_length)
     " --java-unwind-enum-static    try to unwind loops in static initialization of enums\n"
+    // NOLINTNEXTLINE(whitespace/line_length)
+    " --lazy-methods               only convert methods that may be called from the entry point\n"
+    // NOLINTNEXTLINE(whitespace/line_length)
+    " --java-class-cache dir       keep the parsed classes of JAR files in dir\n"
     "\n"
     "Semantic transformations:\n"
     " --nondet-static              add nondeterministic initialization of variables with static lifetime\n" // NOLINT(*)
@@ -1167,15 +1244,25 @@ void cbmc_parse_optionst::help()
     " --unwind nr                  unwind nr times\n"
     " --unwindset L:B,...          unwind loop L with a bound of B\n"
     "                              (use --show-loops to get the loop IDs)\n"
+    " --incremental                increase the unwinding bound until a property\n" // NOLINT(*)
+    "                              fails or the loops are unwound completely\n"
+    " --unwind-min nr              start incremental unwinding with bound nr\n"
+    " --unwind-max nr              stop incremental unwinding at bound nr\n"
+    "                              (default: 100)\n"
     " --show-vcc                   show the verification conditions\n"
     " --slice-formula              remove assignments unrelated to property\n"
     " --unwinding-assertions       generate unwinding assertions\n"
     " --partial-loops              permit paths with partial loops\n"
+    " --bdd-guards                 represent the path conditions as BDDs\n"
+    " --stream-conversion          pass the formula to the solver during\n"
+    "                              symbolic execution\n"
     " --no-pretty-names            do not simplify identifiers\n"
     " --graphml-witness filename   write the witness in GraphML format to filename\n" // NOLINT(*)
     "\n"
     "Backend options:\n"
     " --dimacs                     generate CNF in DIMACS format\n"
+    " --aig                        simplify the formula using an and-inverter graph\n" // NOLINT(*)
+    " --sat-portfolio              run all available SAT solvers in parallel\n" // NOLINT(*)
     " --beautify                   beautify the counterexample (greedy heuristic)\n" // NOLINT(*)
     " --localize-faults            localize faults (experimental)\n"
     " --smt1                       use default SMT1 solver (obsolete)\n"
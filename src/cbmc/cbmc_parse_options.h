@@ -30,6 +30,8 @@ class optionst;
   "D:I:(c89)(c99)(c11)(cpp89)(cpp99)(cpp11)" \
   "(classpath):(cp):(main-class):" \
   "(depth):(partial-loops)(no-unwinding-assertions)(unwinding-assertions)" \
+  "(bdd-guards)(stream-conversion)" \
+  "(incremental)(unwind-min):(unwind-max):" \
   OPT_GOTO_CHECK \
   "(no-assertions)(no-assumptions)" \
   "(xml-ui)(xml-interface)(json-ui)" \
@@ -37,14 +39,15 @@ class optionst;
   "(no-sat-preprocessor)" \
   "(no-pretty-names)(beautify)" \
   "(dimacs)(refine)(max-node-refinement):(refine-arrays)(refine-arithmetic)"\
-  "(aig)(16)(32)(64)(LP64)(ILP64)(LLP64)(ILP32)(LP32)" \
+  "(aig)(sat-portfolio)(16)(32)(64)(LP64)(ILP64)(LLP64)(ILP32)(LP32)" \
   "(little-endian)(big-endian)" \
   "(show-goto-functions)(show-loops)" \
   "(show-symbol-table)(show-parse-tree)(show-vcc)" \
   "(show-claims)(claim):(show-properties)(show-reachable-properties)" \
-  "(property):(stop-on-fail)(trace)" \
+  "(property):(stop-on-fail)(trace)(parallel-properties):" \
+  "(cube-and-conquer):" \
   "(error-label):(verbosity):(no-library)" \
-  "(nondet-static)" \
+  "(nondet-static)(parallel-conversion):" \
   "(version)" \
   "(cover):(symex-coverage-report):" \
   "(mm):" \
@@ -55,6 +58,7 @@ class optionst;
   "(round-to-nearest)(round-to-plus-inf)(round-to-minus-inf)(round-to-zero)" \
   "(graphml-witness):" \
   "(java-max-vla-length):(java-unwind-enum-static)" \
+  "(lazy-methods)(java-class-cache):" \
   "(localize-faults)(localize-faults-method):" \
   "(fixedbv)(floatbv)(all-claims)(all-properties)" // legacy, and will eventually disappear // NOLINT(whitespace/line_length)
 
@@ -13,6 +13,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/unicode.h>
 
 #include <solvers/sat/satcheck.h>
+#include <solvers/sat/satcheck_portfolio.h>
 #include <solvers/refinement/bv_refinement.h>
 #include <solvers/smt1/smt1_dec.h>
 #include <solvers/smt2/smt2_dec.h>
@@ -145,23 +146,23 @@ public:
   cbmc_solver_with_aigpropt(
     prop_convt *_prop_conv,
     propt *_prop,
-    aigt *_aig):
+    propt *_sat):
     cbmc_solver_with_propt(_prop_conv, _prop),
-    aig(_aig)
+    sat(_sat)
   {
-    assert(_aig!=NULL);
+    assert(_sat!=NULL);
   }
 
   ~cbmc_solver_with_aigpropt()
   {
-    // delete prop before the AIG
+    // delete the AIG before the SAT solver it feeds
     delete prop;
     prop=NULL;
-    delete aig;
+    delete sat;
   }
 
 protected:
-  aigt *aig;
+  propt *sat;
 };
 
 /*******************************************************************\
@@ -198,6 +199,32 @@ protected:
 
 /*******************************************************************\
 
+Function: new_sat_solver
+
+  Inputs: options, whether the solver may eliminate variables
+
+ Outputs: a new SAT solver
+
+ Purpose:
+
+\*******************************************************************/
+
+static propt *new_sat_solver(const optionst &options, bool simplifier)
+{
+  if(options.get_bool_option("sat-portfolio"))
+  {
+    satcheck_portfoliot *portfolio=new satcheck_portfoliot();
+    portfolio->add_default_solvers(simplifier);
+    return portfolio;
+  }
+  else if(simplifier)
+    return new satcheckt();
+  else
+    return new satcheck_no_simplifiert();
+}
+
+/*******************************************************************\
+
 Function: cbmc_solverst::get_default
 
   Inputs:
@@ -212,11 +239,31 @@ cbmc_solverst::solvert* cbmc_solverst::get_default()
 {
   solvert *solver;
 
-  if(options.get_bool_option("beautify") ||
+  if(options.get_bool_option("aig"))
+  {
+    // The AIG is passed to the solver anew for every call,
+    // and may then refer to variables the simplifier has
+    // eliminated.
+    propt *sat=new_sat_solver(options, false);
+    aig_prop_solvert *aig=new aig_prop_solvert(*sat);
+    aig->set_message_handler(get_message_handler());
+
+    bv_cbmct *bv_cbmc=new bv_cbmct(ns, *aig);
+
+    if(options.get_option("arrays-uf")=="never")
+      bv_cbmc->unbounded_array=bv_cbmct::U_NONE;
+    else if(options.get_option("arrays-uf")=="always")
+      bv_cbmc->unbounded_array=bv_cbmct::U_ALL;
+
+    solver=new cbmc_solver_with_aigpropt(bv_cbmc, aig, sat);
+  }
+  else if(options.get_bool_option("beautify") ||
+     options.get_bool_option("incremental") ||
      !options.get_bool_option("sat-preprocessor")) // no simplifier
   {
-    // simplifier won't work with beautification
-    propt *prop=new satcheck_no_simplifiert();
+    // simplifier won't work with beautification or
+    // incremental unwinding
+    propt *prop=new_sat_solver(options, false);
     prop->set_message_handler(get_message_handler());
 
     bv_cbmct *bv_cbmc=new bv_cbmct(ns, *prop);
@@ -230,18 +277,10 @@ cbmc_solverst::solvert* cbmc_solverst::get_default()
   }
   else // with simplifier
   {
-  #if 1
-    propt *prop=new satcheckt();
+    propt *prop=new_sat_solver(options, true);
     prop->set_message_handler(get_message_handler());
     bv_cbmct *bv_cbmc=new bv_cbmct(ns, *prop);
     solver=new cbmc_solver_with_propt(bv_cbmc, prop);
-  #else
-    aigt *aig=new aigt();
-    propt *prop=new aig_propt(*aig);
-    prop->set_message_handler(get_message_handler());
-    bv_cbmct *bv_cbmc=new bv_cbmct(ns, *prop);
-    solver=new cbmc_solver_with_aigpropt(bv_cbmc, prop, aig);
-  #endif
 
     if(options.get_option("arrays-uf")=="never")
       bv_cbmc->unbounded_array=bv_cbmct::U_NONE;
@@ -295,7 +334,8 @@ cbmc_solverst::solvert* cbmc_solverst::get_bv_refinement()
   propt *prop;
 
   // We offer the option to disable the SAT preprocessor
-  if(options.get_bool_option("sat-preprocessor"))
+  if(options.get_bool_option("sat-preprocessor") &&
+     !options.get_bool_option("incremental"))
   {
     no_beautification();
     prop=new satcheckt();
@@ -127,7 +127,7 @@ void bmct::show_vcc_json(std::ostream &out)
     if(source_location.is_not_nil())
       object["sourceLocation"]=json(source_location);
 
-    const std::string &s=s_it->comment;
+    const std::string &s=id2string(s_it->comment);
     if(!s.empty())
       object["comment"]=json_stringt(s);
 
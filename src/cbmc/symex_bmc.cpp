@@ -10,6 +10,8 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <util/source_location.h>
 
+#include <pointer-analysis/value_set_dereference.h>
+
 #include "symex_bmc.h"
 
 /*******************************************************************\
@@ -37,6 +39,28 @@ symex_bmct::symex_bmct(
 
 /*******************************************************************\
 
+Function: symex_bmct::reset_counters
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: restart the numbering of fresh symbols and the
+          statistics, for running symex on the same program again
+
+\*******************************************************************/
+
+void symex_bmct::reset_counters()
+{
+  total_vccs=0;
+  remaining_vccs=0;
+  nondet_count=0;
+  dynamic_counter=0;
+  value_set_dereferencet::invalid_counter=0;
+}
+
+/*******************************************************************\
+
 Function: symex_bmct::symex_step
 
   Inputs:
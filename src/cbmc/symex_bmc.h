@@ -60,6 +60,10 @@ public:
 
   bool record_coverage;
 
+  // Incremental unwinding runs symex once per bound; fresh
+  // symbols must then be named the same way in every run.
+  void reset_counters();
+
 protected:
   // We have
   // 1) a global limit (max_unwind)
@@ -126,19 +126,43 @@ Function: cpp_languaget::parse
 bool cpp_languaget::parse(
   std::istream &instream,
   const std::string &path)
+{
+  // preprocessing
+
+  std::ostringstream o_preprocessed;
+
+  if(preprocess(instream, path, o_preprocessed))
+    return true;
+
+  std::istringstream i_preprocessed(o_preprocessed.str());
+
+  return parse_preprocessed(i_preprocessed, path);
+}
+
+/*******************************************************************\
+
+Function: cpp_languaget::parse_preprocessed
+
+  Inputs: the output of preprocess, and the path of the source file
+
+ Outputs: true on error
+
+ Purpose:
+
+\*******************************************************************/
+
+bool cpp_languaget::parse_preprocessed(
+  std::istream &instream,
+  const std::string &path)
 {
   // store the path
 
   parse_path=path;
 
-  // preprocessing
-
   std::ostringstream o_preprocessed;
 
   cpp_internal_additions(o_preprocessed);
-
-  if(preprocess(instream, path, o_preprocessed))
-    return true;
+  o_preprocessed << instream.rdbuf();
 
   std::istringstream i_preprocessed(o_preprocessed.str());
 
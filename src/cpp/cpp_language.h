@@ -30,6 +30,10 @@ public:
     std::istream &instream,
     const std::string &path) override;
 
+  bool parse_preprocessed(
+    std::istream &instream,
+    const std::string &path) override;
+
   bool typecheck(
     symbol_tablet &symbol_table,
     const std::string &module) override;
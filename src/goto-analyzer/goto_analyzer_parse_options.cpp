@@ -304,6 +304,8 @@ int goto_analyzer_parse_optionst::doit()
     optionst options;
     options.set_option("json", cmdline.get_value("json"));
     options.set_option("xml", cmdline.get_value("xml"));
+    options.set_option(
+      "function-summaries", cmdline.isset("function-summaries"));
     bool result=
       static_analyzer(goto_model, options, get_message_handler());
     return result?10:0;
@@ -495,6 +497,8 @@ void goto_analyzer_parse_optionst::help()
     // NOLINTNEXTLINE(whitespace/line_length)
     " --json file_name             output results in JSON format to given file\n"
     " --xml file_name              output results in XML format to given file\n"
+    // NOLINTNEXTLINE(whitespace/line_length)
+    " --function-summaries         reuse the effect of functions called with equal states\n"
     "\n"
     "C/C++ frontend options:\n"
     " -I path                      set include path (C/C++)\n"
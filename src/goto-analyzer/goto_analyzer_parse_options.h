@@ -37,7 +37,7 @@ class optionst;
   "(show-local-may-alias)" \
   "(json):(xml):" \
   "(unreachable-instructions)" \
-  "(intervals)(show-intervals)" \
+  "(intervals)(show-intervals)(function-summaries)" \
   "(non-null)(show-non-null)"
 
 class goto_analyzer_parse_optionst:
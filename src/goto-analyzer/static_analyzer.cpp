@@ -62,8 +62,14 @@ Function: static_analyzert::operator()
 bool static_analyzert::operator()()
 {
   status() << "performing interval analysis" << eom;
+  interval_analysis.use_summaries=
+    options.get_bool_option("function-summaries");
   interval_analysis(goto_functions, ns);
 
+  if(interval_analysis.use_summaries)
+    statistics() << "Function summaries reused: "
+                 << interval_analysis.summaries_reused << eom;
+
   if(!options.get_option("json").empty())
     json_report(options.get_option("json"));
   else if(!options.get_option("xml").empty())
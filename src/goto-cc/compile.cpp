@@ -13,6 +13,8 @@ Date: June 2006
 #include <iostream>
 #include <cstdlib>
 #include <algorithm>
+#include <cstdio>
+#include <memory>
 
 #include <util/config.h>
 #include <util/tempdir.h>
@@ -23,6 +25,7 @@ Date: June 2006
 #include <util/irep_serialization.h>
 #include <util/suffix.h>
 #include <util/get_base_name.h>
+#include <util/string_hash.h>
 
 #include <ansi-c/ansi_c_language.h>
 #include <ansi-c/ansi_c_entry_point.h>
@@ -55,14 +58,17 @@ Date: June 2006
     defined(__CYGWIN__) || \
     defined(__MACH__)
 #include <unistd.h>
+#include <sys/stat.h>
 #endif
 
 #ifdef _WIN32
 #include <direct.h>
+#include <process.h>
 #include <windows.h>
 #define chdir _chdir
 #define popen _popen
 #define pclose _pclose
+#define getpid _getpid
 #endif
 
 /*******************************************************************\
@@ -387,15 +393,14 @@ bool compilet::link()
   convert_symbols(compiled_functions);
 
   // parse object files
-  while(object_files.size()>0)
-  {
-    std::string file_name=object_files.front();
-    object_files.pop_front();
+  if(read_objects_and_link(
+       std::vector<std::string>(object_files.begin(), object_files.end()),
+       symbol_table,
+       compiled_functions,
+       get_message_handler()))
+    return true;
 
-    if(read_object_and_link(file_name, symbol_table,
-                            compiled_functions, get_message_handler()))
-      return true;
-  }
+  object_files.clear();
 
   // produce entry point?
 
@@ -447,7 +452,27 @@ bool compilet::compile()
     if(echo_file_name)
       status() << file_name << eom;
 
-    bool r=parse_source(file_name); // don't break the program!
+    std::string cfn;
+
+    if(output_file_object=="")
+      cfn=get_base_name(file_name, true)+"."+object_file_extension;
+    else
+      cfn=output_file_object;
+
+    std::string cache_key, preprocessed;
+
+    if(!cache_directory.empty() &&
+       (mode==COMPILE_ONLY || mode==ASSEMBLE_ONLY) &&
+       !get_cache_key(file_name, cache_key, preprocessed) &&
+       get_cached_object_file(cache_key, cfn))
+      continue;
+
+    // on a miss, the text preprocessed for the key is parsed
+    const std::string *p=cache_key.empty()?NULL:&preprocessed;
+
+    bool r=parse_source(file_name, p); // don't break the program!
+
+    preprocessed.clear();
 
     if(r)
     {
@@ -471,16 +496,12 @@ bool compilet::compile()
       // "compile" functions
       convert_symbols(compiled_functions);
 
-      std::string cfn;
-
-      if(output_file_object=="")
-        cfn=get_base_name(file_name, true)+"."+object_file_extension;
-      else
-        cfn=output_file_object;
-
       if(write_object_file(cfn, symbol_table, compiled_functions))
         return true;
 
+      if(!cache_key.empty())
+        add_to_cache(cache_key, cfn);
+
       symbol_table.clear(); // clean symbol table for next source file.
       compiled_functions.clear();
     }
@@ -491,17 +512,246 @@ bool compilet::compile()
 
 /*******************************************************************\
 
-Function: compilet::parse
+Function: compilet::get_cache_key
 
   Inputs: file_name
 
+ Outputs: true if the file can't be cached, false otherwise
+
+ Purpose: The key is the preprocessed source file, together with
+          everything else that may change the object file. The
+          preprocessed source file is kept for parsing it.
+
+\*******************************************************************/
+
+bool compilet::get_cache_key(
+  const std::string &file_name,
+  std::string &key,
+  std::string &preprocessed)
+{
+  if(file_name=="-")
+    return true;
+
+  languaget *languagep;
+
+  if(override_language!="")
+  {
+    if(override_language=="c++" || override_language=="c++-header")
+      languagep=get_language_from_mode("cpp");
+    else
+      languagep=get_language_from_mode("C");
+  }
+  else
+    languagep=get_language_from_filename(file_name);
+
+  if(languagep==NULL)
+    return true;
+
+  std::unique_ptr<languaget> language(languagep);
+
+  if(language->id()!="C" && language->id()!="cpp")
+    return true;
+
+  #ifdef _MSC_VER
+  std::ifstream infile(widen(file_name));
+  #else
+  std::ifstream infile(file_name);
+  #endif
+
+  if(!infile)
+    return true;
+
+  language->set_message_handler(get_message_handler());
+
+  std::ostringstream preprocessed_stream;
+
+  if(language->preprocess(infile, file_name, preprocessed_stream))
+    return true;
+
+  preprocessed=preprocessed_stream.str();
+
+  std::ostringstream key_stream;
+
+  key_stream << CBMC_VERSION << '\n'
+             << language->id() << '\n'
+             << working_directory << '\n'
+             << cache_options << '\n'
+             << preprocessed;
+
+  key=key_stream.str();
+
+  return false;
+}
+
+/*******************************************************************\
+
+Function: cache_key_digest
+
+  Inputs: a key
+
+ Outputs: its length, and a hash of it that is independent of the
+          one that names the entry
+
+ Purpose: The first line of an entry, so that a key that only
+          shares the name of the entry is told apart without
+          reading the text of the key that is stored.
+
+\*******************************************************************/
+
+static std::string cache_key_digest(const std::string &key)
+{
+  // 64-bit FNV-1a
+  unsigned long long h=14695981039346656037ull;
+
+  for(const auto c : key)
+  {
+    h^=(unsigned char)c;
+    h*=1099511628211ull;
+  }
+
+  std::ostringstream digest;
+  digest << key.size() << ' ' << std::hex << h;
+
+  return digest.str();
+}
+
+/*******************************************************************\
+
+Function: compilet::cache_file_name
+
+  Inputs: a key
+
+ Outputs: the name of the file of its entry
+
+ Purpose: Keys with the same hash share an entry, which holds the
+          key and the object file of the last of them that was
+          compiled.
+
+\*******************************************************************/
+
+std::string compilet::cache_file_name(const std::string &key) const
+{
+  std::ostringstream name;
+  name << std::hex << hash_string(key) << ".entry";
+
+  return concat_dir_file(cache_directory, name.str());
+}
+
+/*******************************************************************\
+
+Function: compilet::get_cached_object_file
+
+  Inputs: a key, and the name of the object file to write
+
+ Outputs: true if the object file was found in the cache
+
+ Purpose: The object file is read from the same file as the key it
+          is compared with, so it's the object file of that key,
+          even if the entry is replaced meanwhile.
+
+\*******************************************************************/
+
+bool compilet::get_cached_object_file(
+  const std::string &key,
+  const std::string &object_file)
+{
+  std::ifstream in(cache_file_name(key), std::ios::binary);
+
+  if(!in)
+    return false;
+
+  // the text of the key is only compared if the digest matches
+  std::string digest;
+
+  if(!std::getline(in, digest) ||
+     digest!=cache_key_digest(key))
+    return false;
+
+  std::string cached_key(key.size(), '\0');
+
+  if(!in.read(&cached_key[0], cached_key.size()) ||
+     cached_key!=key)
+    return false;
+
+  std::ofstream out(object_file, std::ios::binary);
+
+  if(!out)
+    return false;
+
+  out << in.rdbuf();
+
+  if(!out)
+    return false;
+
+  statistics() << "Object `" << object_file
+               << "' taken from the cache" << eom;
+
+  return true;
+}
+
+/*******************************************************************\
+
+Function: compilet::add_to_cache
+
+  Inputs: a key, and the object file compiled for it
+
+ Outputs:
+
+ Purpose: The entry is written under a temporary name first, and
+          then renamed, as another goto-cc may be reading it at the
+          same time. A failure only means the entry isn't added.
+
+\*******************************************************************/
+
+void compilet::add_to_cache(
+  const std::string &key,
+  const std::string &object_file)
+{
+  #ifdef _WIN32
+  _mkdir(cache_directory.c_str());
+  #else
+  mkdir(cache_directory.c_str(), 0777);
+  #endif
+
+  const std::string entry=cache_file_name(key);
+  const std::string tmp=entry+"."+std::to_string(getpid());
+
+  {
+    std::ifstream in(object_file, std::ios::binary);
+    std::ofstream out(tmp, std::ios::binary);
+    out << cache_key_digest(key) << '\n' << key << in.rdbuf();
+
+    if(!in || !out)
+    {
+      warning() << "failed to add `" << object_file
+                << "' to the cache" << eom;
+      std::remove(tmp.c_str());
+      return;
+    }
+  }
+
+  // replaces the entry at once, other than on Windows
+  #ifdef _WIN32
+  std::remove(entry.c_str());
+  #endif
+  std::rename(tmp.c_str(), entry.c_str());
+}
+
+/*******************************************************************\
+
+Function: compilet::parse
+
+  Inputs: file_name, and its preprocessed text, if there is one
+
  Outputs: true on error, false otherwise
 
  Purpose: parses a source file (low-level parsing)
 
 \*******************************************************************/
 
-bool compilet::parse(const std::string &file_name)
+bool compilet::parse(
+  const std::string &file_name,
+  const std::string *preprocessed)
 {
   if(file_name=="-")
     return parse_stdin();
@@ -578,7 +828,17 @@ bool compilet::parse(const std::string &file_name)
   {
     print(8, "Parsing: "+file_name);
 
-    if(language.parse(infile, file_name))
+    bool result;
+
+    if(preprocessed!=NULL)
+    {
+      std::istringstream preprocessed_stream(*preprocessed);
+      result=language.parse_preprocessed(preprocessed_stream, file_name);
+    }
+    else
+      result=language.parse(infile, file_name);
+
+    if(result)
     {
       if(get_ui()==ui_message_handlert::PLAIN)
         error() << "PARSING ERROR" << eom;
@@ -714,7 +974,7 @@ bool compilet::write_bin_object_file(
 
 Function: compilet::parse_source
 
-  Inputs: file_name
+  Inputs: file_name, and its preprocessed text, if there is one
 
  Outputs: true on error, false otherwise
 
@@ -722,9 +982,11 @@ Function: compilet::parse_source
 
 \*******************************************************************/
 
-bool compilet::parse_source(const std::string &file_name)
+bool compilet::parse_source(
+  const std::string &file_name,
+  const std::string *preprocessed)
 {
-  if(parse(file_name))
+  if(parse(file_name, preprocessed))
     return true;
 
   if(typecheck()) // we just want to typecheck this one file here
@@ -45,6 +45,12 @@ public:
   std::string object_file_extension;
   std::string output_file_object, output_file_executable;
 
+  // The object files of compiled source files are kept in the
+  // cache directory, if one is given, keyed by the preprocessed
+  // source and the options, which may affect the conversion.
+  std::string cache_directory;
+  std::string cache_options;
+
   explicit compilet(cmdlinet &_cmdline);
 
   ~compilet();
@@ -53,13 +59,17 @@ public:
   bool find_library(const std::string &);
   bool is_elf_file(const std::string &);
 
-  bool parse(const std::string &filename);
+  bool parse(
+    const std::string &filename,
+    const std::string *preprocessed=NULL);
   bool parse_stdin();
   bool doit();
   bool compile();
   bool link();
 
-  bool parse_source(const std::string &);
+  bool parse_source(
+    const std::string &,
+    const std::string *preprocessed=NULL);
 
   bool write_object_file(
     const std::string &,
@@ -78,6 +88,18 @@ protected:
   void add_compiler_specific_defines(class configt &config) const;
 
   void convert_symbols(goto_functionst &dest);
+
+  bool get_cache_key(
+    const std::string &file_name,
+    std::string &key,
+    std::string &preprocessed);
+  std::string cache_file_name(const std::string &key) const;
+  bool get_cached_object_file(
+    const std::string &key,
+    const std::string &object_file);
+  void add_to_cache(
+    const std::string &key,
+    const std::string &object_file);
 };
 
 #endif // CPROVER_GOTO_CC_COMPILE_H
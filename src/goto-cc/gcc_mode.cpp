@@ -432,6 +432,15 @@ int gcc_modet::doit()
     compiler.output_file_executable="a.out";
   }
 
+  if(cmdline.isset("cache-dir"))
+  {
+    compiler.cache_directory=cmdline.get_value("cache-dir");
+
+    // the object files may depend on any of the options
+    for(const auto &arg : cmdline.parsed_argv)
+      compiler.cache_options+=arg.arg+'\n';
+  }
+
   // We now iterate over any input files
 
   temp_dirt temp_dir("goto-cc-XXXXXX");
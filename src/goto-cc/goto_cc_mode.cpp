@@ -94,6 +94,8 @@ void goto_cc_modet::help()
   " --native-assembler cmd      command to invoke as assembler (goto-as only)\n"
   " --print-rejected-preprocessed-source file\n"
   "                             copy failing (preprocessed) source to file\n"
+  " --cache-dir dir             keep the compiled object files in dir, and\n"
+  "                             reuse them for unchanged sources\n"
   "\n";
 }
 
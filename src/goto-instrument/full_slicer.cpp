@@ -6,8 +6,14 @@ Author: Daniel Kroening, kroening@kroening.com
 
 \*******************************************************************/
 
+#include <fstream>
+#include <memory>
+
 #include <util/find_symbols.h>
 #include <util/cprover_prefix.h>
+#include <util/irep_hash.h>
+#include <util/string_hash.h>
+#include <util/unicode.h>
 #ifdef DEBUG_FULL_SLICERT
 #endif
 
@@ -31,19 +37,15 @@ Function: full_slicert::add_dependencies
 \*******************************************************************/
 
 void full_slicert::add_dependencies(
-  const cfgt::nodet &node,
-  queuet &queue,
-  const dependence_grapht &dep_graph,
-  const dep_node_to_cfgt &dep_node_to_cfg)
+  cfgt::entryt entry,
+  queuet &queue)
 {
-  const dependence_grapht::nodet &d_node=
-    dep_graph[dep_graph[node.PC].get_node_id()];
+  const goto_programt::const_targett reason=cfg[entry].PC;
 
-  for(dependence_grapht::edgest::const_iterator
-      it=d_node.in.begin();
-      it!=d_node.in.end();
-      ++it)
-    add_to_queue(queue, dep_node_to_cfg[it->first], node.PC);
+  for(std::size_t i=dependencies_begin[entry];
+      i<dependencies_begin[entry+1];
+      ++i)
+    add_to_queue(queue, dependencies[i], reason);
 }
 
 /*******************************************************************\
@@ -139,8 +141,7 @@ Function: full_slicert::add_jumps
 
 void full_slicert::add_jumps(
   queuet &queue,
-  jumpst &jumps,
-  const cfg_post_dominatorst &cfg_post_dominators)
+  jumpst &jumps)
 {
   // Based on:
   // On slicing programs with jump statements
@@ -197,14 +198,17 @@ void full_slicert::add_jumps(
       continue;
     }
 
-    cfg_post_dominatorst::cfgt::entry_mapt::const_iterator e=
-      cfg_post_dominators.cfg.entry_map.find(j.PC);
-    assert(e!=cfg_post_dominators.cfg.entry_map.end());
-    const cfg_post_dominatorst::cfgt::nodet &n=
-      cfg_post_dominators.cfg[e->second];
+    cfgt::entry_mapt::const_iterator lex_succ_entry=
+      cfg.entry_map.find(lex_succ);
+    assert(lex_succ_entry!=cfg.entry_map.end());
+
+    const cfgt::entryt *const pd_begin=
+      post_dominators.data()+post_dominators_begin[*it];
+    const cfgt::entryt *const pd_end=
+      post_dominators.data()+post_dominators_begin[*it+1];
 
     // find the nearest post-dominator in slice
-    if(n.dominators.find(lex_succ)==n.dominators.end())
+    if(std::find(pd_begin, pd_end, lex_succ_entry->second)==pd_end)
     {
       add_to_queue(queue, *it, lex_succ);
       jumps.erase(it);
@@ -215,28 +219,13 @@ void full_slicert::add_jumps(
       // lex_succ
       goto_programt::const_targett nearest=lex_succ;
       std::size_t post_dom_size=0;
-      for(cfg_dominatorst::target_sett::const_iterator
-          d_it=n.dominators.begin();
-          d_it!=n.dominators.end();
-          ++d_it)
+      for(const cfgt::entryt *d_it=pd_begin; d_it!=pd_end; ++d_it)
       {
-        cfgt::entry_mapt::const_iterator entry=
-          cfg.entry_map.find(*d_it);
-        assert(entry!=cfg.entry_map.end());
-
-        if(cfg[entry->second].node_required)
+        if(cfg[*d_it].node_required &&
+           post_dominator_count[*d_it]>post_dom_size)
         {
-          cfg_post_dominatorst::cfgt::entry_mapt::const_iterator e2=
-            cfg_post_dominators.cfg.entry_map.find(*d_it);
-          assert(e2!=cfg_post_dominators.cfg.entry_map.end());
-          const cfg_post_dominatorst::cfgt::nodet &n2=
-            cfg_post_dominators.cfg[e2->second];
-
-          if(n2.dominators.size()>post_dom_size)
-          {
-            nearest=*d_it;
-            post_dom_size=n2.dominators.size();
-          }
+          nearest=cfg[*d_it].PC;
+          post_dom_size=post_dominator_count[*d_it];
         }
       }
       if(nearest!=lex_succ)
@@ -263,23 +252,10 @@ Function: full_slicert::fixedpoint
 \*******************************************************************/
 
 void full_slicert::fixedpoint(
-  goto_functionst &goto_functions,
   queuet &queue,
   jumpst &jumps,
-  decl_deadt &decl_dead,
-  const dependence_grapht &dep_graph)
+  decl_deadt &decl_dead)
 {
-  std::vector<cfgt::entryt> dep_node_to_cfg;
-  dep_node_to_cfg.reserve(dep_graph.size());
-  for(dependence_grapht::node_indext i=0; i<dep_graph.size(); ++i)
-  {
-    cfgt::entry_mapt::const_iterator entry=
-      cfg.entry_map.find(dep_graph[i].PC);
-    assert(entry!=cfg.entry_map.end());
-
-    dep_node_to_cfg.push_back(entry->second);
-  }
-
   // process queue until empty
   while(!queue.empty())
   {
@@ -297,17 +273,17 @@ void full_slicert::fixedpoint(
       node.node_required=true;
 
       // add data and control dependencies of node
-      add_dependencies(node, queue, dep_graph, dep_node_to_cfg);
+      add_dependencies(e, queue);
 
       // retain all calls of the containing function
-      add_function_calls(node, queue, goto_functions);
+      add_function_calls(node, queue, *program);
 
       // find all the symbols it uses to add declarations
       add_decl_dead(node, queue, decl_dead);
     }
 
     // add any required jumps
-    add_jumps(queue, jumps, dep_graph.cfg_post_dominators());
+    add_jumps(queue, jumps);
   }
 }
 
@@ -341,7 +317,7 @@ static bool implicit(goto_programt::const_targett target)
 
 /*******************************************************************\
 
-Function: full_slicert::operator()
+Function: full_slicert::build
 
   Inputs:
 
@@ -351,14 +327,106 @@ Function: full_slicert::operator()
 
 \*******************************************************************/
 
-void full_slicert::operator()(
-  goto_functionst &goto_functions,
-  const namespacet &ns,
-  slicing_criteriont &criterion)
+void full_slicert::build(
+  const goto_functionst &goto_functions,
+  const namespacet &ns)
 {
+  program=&goto_functions;
+
   // build the CFG data structure
   cfg(goto_functions);
 
+  // compute program dependence graph (and post-dominators)
+  dependence_grapht dep_graph(ns);
+  dep_graph(goto_functions, ns);
+
+  // the dependencies, as a compact array, by CFG node
+  std::vector<cfgt::entryt> dep_node_to_cfg;
+  dep_node_to_cfg.reserve(dep_graph.size());
+  for(dependence_grapht::node_indext i=0; i<dep_graph.size(); ++i)
+  {
+    cfgt::entry_mapt::const_iterator entry=
+      cfg.entry_map.find(dep_graph[i].PC);
+    assert(entry!=cfg.entry_map.end());
+
+    dep_node_to_cfg.push_back(entry->second);
+  }
+
+  dependencies_begin.clear();
+  dependencies_begin.reserve(cfg.size()+1);
+  dependencies.clear();
+
+  post_dominators_begin.clear();
+  post_dominators_begin.reserve(cfg.size()+1);
+  post_dominators.clear();
+  post_dominator_count.clear();
+  post_dominator_count.reserve(cfg.size());
+
+  const cfg_post_dominatorst &cfg_post_dominators=
+    dep_graph.cfg_post_dominators();
+
+  for(cfgt::entryt e=0; e<cfg.size(); ++e)
+  {
+    dependencies_begin.push_back(dependencies.size());
+
+    const dependence_grapht::nodet &d_node=
+      dep_graph[dep_graph[cfg[e].PC].get_node_id()];
+
+    for(dependence_grapht::edgest::const_iterator
+        it=d_node.in.begin();
+        it!=d_node.in.end();
+        ++it)
+      dependencies.push_back(dep_node_to_cfg[it->first]);
+
+    post_dominators_begin.push_back(post_dominators.size());
+
+    cfg_post_dominatorst::cfgt::entry_mapt::const_iterator p_e=
+      cfg_post_dominators.cfg.entry_map.find(cfg[e].PC);
+
+    // the functions without body
+    if(p_e==cfg_post_dominators.cfg.entry_map.end())
+    {
+      post_dominator_count.push_back(0);
+      continue;
+    }
+
+    const cfg_dominatorst::target_sett &targets=
+      cfg_post_dominators.cfg[p_e->second].dominators;
+
+    post_dominator_count.push_back(targets.size());
+
+    if(is_jump(e))
+    {
+      for(const auto &target : targets)
+      {
+        cfgt::entry_mapt::const_iterator entry=cfg.entry_map.find(target);
+        assert(entry!=cfg.entry_map.end());
+
+        post_dominators.push_back(entry->second);
+      }
+    }
+  }
+
+  dependencies_begin.push_back(dependencies.size());
+  post_dominators_begin.push_back(post_dominators.size());
+}
+
+/*******************************************************************\
+
+Function: full_slicert::slice
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void full_slicert::slice(
+  slicing_criteriont &criterion,
+  goto_functionst &dest)
+{
   // fill queue with according to slicing criterion
   queuet queue;
   // gather all unconditional jumps as they may need to be included
@@ -371,12 +439,17 @@ void full_slicert::operator()(
       e_it!=cfg.entry_map.end();
       e_it++)
   {
+    // left over from an earlier slice
+    cfg[e_it->second].node_required=false;
+#ifdef DEBUG_FULL_SLICERT
+    cfg[e_it->second].required_by.clear();
+#endif
+
     if(criterion(e_it->first))
       add_to_queue(queue, e_it->second, e_it->first);
     else if(implicit(e_it->first))
       add_to_queue(queue, e_it->second, e_it->first);
-    else if((e_it->first->is_goto() && e_it->first->guard.is_true()) ||
-            e_it->first->is_throw())
+    else if(is_jump(e_it->second))
       jumps.push_back(e_it->second);
     else if(e_it->first->is_decl())
     {
@@ -390,22 +463,27 @@ void full_slicert::operator()(
     }
   }
 
-  // compute program dependence graph (and post-dominators)
-  dependence_grapht dep_graph(ns);
-  dep_graph(goto_functions, ns);
-
   // compute the fixedpoint
-  fixedpoint(goto_functions, queue, jumps, decl_dead, dep_graph);
+  fixedpoint(queue, jumps, decl_dead);
 
   // now replace those instructions that are not needed
-  // by skips
+  // by skips, walking the program and its copy side by side
 
-  Forall_goto_functions(f_it, goto_functions)
+  Forall_goto_functions(f_it, dest)
     if(f_it->second.body_available())
     {
+      goto_functionst::function_mapt::const_iterator p_f_it=
+        program->function_map.find(f_it->first);
+      assert(p_f_it!=program->function_map.end());
+
+      goto_programt::const_targett p_it=
+        p_f_it->second.body.instructions.begin();
+
       Forall_goto_program_instructions(i_it, f_it->second.body)
       {
-        const cfgt::entryt &e=cfg.entry_map[i_it];
+        assert(p_it!=p_f_it->second.body.instructions.end());
+
+        const cfgt::entryt &e=cfg.entry_map[p_it];
         if(!i_it->is_end_function() && // always retained
            !cfg[e].node_required)
           i_it->make_skip();
@@ -427,12 +505,328 @@ void full_slicert::operator()(
           i_it->source_location.set_comment(c); // for dump-c
         }
 #endif
+
+        ++p_it;
       }
     }
 
   // remove the skips
-  remove_skip(goto_functions);
-  goto_functions.update();
+  remove_skip(dest);
+  dest.update();
+}
+
+/*******************************************************************\
+
+Function: stable_hash
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: a hash of an irep, without the comments, that doesn't
+          depend on the order the strings were created in
+
+\*******************************************************************/
+
+static std::size_t stable_hash(const irept &irep)
+{
+  std::size_t result=hash_string(id2string(irep.id()));
+
+  forall_irep(it, irep.get_sub())
+    result=hash_combine(result, stable_hash(*it));
+
+  forall_named_irep(it, irep.get_named_sub())
+  {
+    result=hash_combine(result, hash_string(id2string(it->first)));
+    result=hash_combine(result, stable_hash(it->second));
+  }
+
+  return result;
+}
+
+/*******************************************************************\
+
+Function: function_digest
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: a hash of the instructions of a function
+
+\*******************************************************************/
+
+static std::size_t function_digest(const goto_programt &goto_program)
+{
+  std::map<const goto_programt::instructiont *, std::size_t> offsets;
+  forall_goto_program_instructions(i_it, goto_program)
+    offsets.insert(std::make_pair(&*i_it, offsets.size()));
+
+  std::size_t result=0;
+
+  forall_goto_program_instructions(i_it, goto_program)
+  {
+    result=hash_combine(result, i_it->type);
+    result=hash_combine(result, stable_hash(i_it->code));
+    result=hash_combine(result, stable_hash(i_it->guard));
+
+    for(const auto &target : i_it->targets)
+      result=hash_combine(result, offsets[&*target]);
+  }
+
+  return result;
+}
+
+/*******************************************************************\
+
+Function: full_slicert::get_positions
+
+  Inputs: the program given to build
+
+ Outputs: the function and the offset of the instruction
+          of each CFG node
+
+ Purpose:
+
+\*******************************************************************/
+
+void full_slicert::get_positions(
+  const goto_functionst &goto_functions,
+  std::vector<std::pair<irep_idt, std::size_t> > &dest) const
+{
+  dest.resize(cfg.size());
+
+  forall_goto_functions(f_it, goto_functions)
+  {
+    std::size_t offset=0;
+
+    forall_goto_program_instructions(i_it, f_it->second.body)
+    {
+      cfgt::entry_mapt::const_iterator entry=cfg.entry_map.find(i_it);
+
+      if(entry!=cfg.entry_map.end())
+        dest[entry->second]=std::make_pair(f_it->first, offset);
+
+      ++offset;
+    }
+  }
+}
+
+/*******************************************************************\
+
+Function: full_slicert::write
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: The functions are written with a digest of their
+          instructions, and the nodes by their position.
+
+\*******************************************************************/
+
+void full_slicert::write(std::ostream &out) const
+{
+  out << "full-slicer-graph 1\n";
+
+  std::map<irep_idt, std::size_t> function_numbers;
+
+  out << program->function_map.size() << '\n';
+
+  forall_goto_functions(f_it, *program)
+  {
+    function_numbers.insert(
+      std::make_pair(f_it->first, function_numbers.size()));
+
+    out << f_it->first << '\n'
+        << f_it->second.body.instructions.size() << ' '
+        << function_digest(f_it->second.body) << '\n';
+  }
+
+  std::vector<std::pair<irep_idt, std::size_t> > positions;
+  get_positions(*program, positions);
+
+  out << cfg.size() << '\n';
+
+  for(cfgt::entryt e=0; e<cfg.size(); ++e)
+  {
+    out << function_numbers[positions[e].first] << ' '
+        << positions[e].second << ' '
+        << post_dominator_count[e];
+
+    out << ' ' << dependencies_begin[e+1]-dependencies_begin[e];
+    for(std::size_t i=dependencies_begin[e];
+        i<dependencies_begin[e+1];
+        ++i)
+      out << ' ' << dependencies[i];
+
+    out << ' ' << post_dominators_begin[e+1]-post_dominators_begin[e];
+    for(std::size_t i=post_dominators_begin[e];
+        i<post_dominators_begin[e+1];
+        ++i)
+      out << ' ' << post_dominators[i];
+
+    out << '\n';
+  }
+}
+
+/*******************************************************************\
+
+Function: full_slicert::read
+
+  Inputs: a graph written by write, and the program
+
+ Outputs: true if the graph can't be read, or was written for
+          another program
+
+ Purpose: The CFG nodes of the program are numbered anew, and the
+          graph is translated to these numbers.
+
+\*******************************************************************/
+
+bool full_slicert::read(
+  std::istream &in,
+  const goto_functionst &goto_functions)
+{
+  std::string header;
+  std::getline(in, header);
+  if(header!="full-slicer-graph 1")
+    return true;
+
+  std::size_t number_of_functions;
+  if(!(in >> number_of_functions) ||
+     number_of_functions!=goto_functions.function_map.size())
+    return true;
+
+  // the functions must be the same, in the same order
+  forall_goto_functions(f_it, goto_functions)
+  {
+    std::string name;
+    std::size_t size, digest;
+
+    in >> std::ws;
+    std::getline(in, name);
+
+    if(!(in >> size >> digest) ||
+       name!=id2string(f_it->first) ||
+       size!=f_it->second.body.instructions.size() ||
+       digest!=function_digest(f_it->second.body))
+      return true;
+  }
+
+  program=&goto_functions;
+  cfg(goto_functions);
+
+  std::size_t number_of_nodes;
+  if(!(in >> number_of_nodes) || number_of_nodes!=cfg.size())
+    return true;
+
+  // the CFG node of each position
+  std::vector<std::vector<cfgt::entryt> > entries;
+  entries.reserve(number_of_functions);
+
+  forall_goto_functions(f_it, goto_functions)
+  {
+    entries.push_back(std::vector<cfgt::entryt>());
+    entries.back().reserve(f_it->second.body.instructions.size());
+
+    forall_goto_program_instructions(i_it, f_it->second.body)
+    {
+      cfgt::entry_mapt::const_iterator entry=cfg.entry_map.find(i_it);
+      entries.back().push_back(
+        entry==cfg.entry_map.end()?cfg.size():entry->second);
+    }
+  }
+
+  // the nodes of the graph that was written, in the new numbering
+  std::vector<cfgt::entryt> nodes(number_of_nodes);
+  std::vector<std::vector<cfgt::entryt> > node_dependencies(
+    number_of_nodes);
+  std::vector<std::vector<cfgt::entryt> > node_post_dominators(
+    number_of_nodes);
+  std::vector<std::size_t> node_post_dominator_count(number_of_nodes);
+
+  for(std::size_t n=0; n<number_of_nodes; ++n)
+  {
+    std::size_t function, offset, size;
+    if(!(in >> function >> offset >> node_post_dominator_count[n]) ||
+       function>=entries.size() ||
+       offset>=entries[function].size() ||
+       entries[function][offset]==cfg.size())
+      return true;
+
+    nodes[n]=entries[function][offset];
+
+    if(!(in >> size))
+      return true;
+
+    node_dependencies[n].resize(size);
+    for(auto &d : node_dependencies[n])
+      if(!(in >> d) || d>=number_of_nodes)
+        return true;
+
+    if(!(in >> size))
+      return true;
+
+    node_post_dominators[n].resize(size);
+    for(auto &d : node_post_dominators[n])
+      if(!(in >> d) || d>=number_of_nodes)
+        return true;
+  }
+
+  // the graph, by the new numbers
+  std::vector<std::size_t> by_entry(cfg.size(), number_of_nodes);
+  for(std::size_t n=0; n<number_of_nodes; ++n)
+    by_entry[nodes[n]]=n;
+
+  dependencies_begin.clear();
+  dependencies.clear();
+  post_dominators_begin.clear();
+  post_dominators.clear();
+  post_dominator_count.clear();
+
+  for(cfgt::entryt e=0; e<cfg.size(); ++e)
+  {
+    const std::size_t n=by_entry[e];
+    if(n==number_of_nodes)
+      return true;
+
+    dependencies_begin.push_back(dependencies.size());
+    for(const auto &d : node_dependencies[n])
+      dependencies.push_back(nodes[d]);
+
+    post_dominators_begin.push_back(post_dominators.size());
+    for(const auto &d : node_post_dominators[n])
+      post_dominators.push_back(nodes[d]);
+
+    post_dominator_count.push_back(node_post_dominator_count[n]);
+  }
+
+  dependencies_begin.push_back(dependencies.size());
+  post_dominators_begin.push_back(post_dominators.size());
+
+  return false;
+}
+
+/*******************************************************************\
+
+Function: full_slicert::operator()
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void full_slicert::operator()(
+  goto_functionst &goto_functions,
+  const namespacet &ns,
+  slicing_criteriont &criterion)
+{
+  build(goto_functions, ns);
+  slice(criterion, goto_functions);
 }
 
 /*******************************************************************\
@@ -498,6 +892,120 @@ void property_slicer(
 
 /*******************************************************************\
 
+Function: property_slicer
+
+  Inputs: a slicer, the program it's for, and the properties
+
+ Outputs: a slice of the program for each of the properties
+
+ Purpose:
+
+\*******************************************************************/
+
+static void property_slicer(
+  full_slicert &slicer,
+  const goto_functionst &goto_functions,
+  const std::list<std::string> &properties,
+  std::map<std::string, goto_functionst> &slices)
+{
+  for(std::list<std::string>::const_iterator
+      it=properties.begin();
+      it!=properties.end();
+      ++it)
+  {
+    goto_functionst &slice=slices[*it];
+    slice.copy_from(goto_functions);
+
+    const std::list<std::string> property(1, *it);
+    properties_criteriont p(property);
+    slicer.slice(p, slice);
+  }
+}
+
+/*******************************************************************\
+
+Function: property_slicer
+
+  Inputs: a program, and the properties to slice it for
+
+ Outputs: a slice of the program for each of the properties
+
+ Purpose: The dependence graph is computed once, rather than for
+          each property.
+
+\*******************************************************************/
+
+void property_slicer(
+  const goto_functionst &goto_functions,
+  const namespacet &ns,
+  const std::list<std::string> &properties,
+  std::map<std::string, goto_functionst> &slices)
+{
+  full_slicert slicer;
+  slicer.build(goto_functions, ns);
+  property_slicer(slicer, goto_functions, properties, slices);
+}
+
+/*******************************************************************\
+
+Function: property_slicer
+
+  Inputs: a program, the properties to slice it for, and a file
+          for the dependence graph
+
+ Outputs: a slice of the program for each of the properties;
+          returns true iff the graph was read from the file
+
+ Purpose: The dependence graph is read from the file if it was
+          written for this program, and written to it otherwise.
+
+\*******************************************************************/
+
+bool property_slicer(
+  const goto_functionst &goto_functions,
+  const namespacet &ns,
+  const std::list<std::string> &properties,
+  std::map<std::string, goto_functionst> &slices,
+  const std::string &graph_file)
+{
+  std::unique_ptr<full_slicert> slicer(new full_slicert());
+  bool graph_read=false;
+
+  {
+    #ifdef _MSC_VER
+    std::ifstream in(widen(graph_file), std::ios::binary);
+    #else
+    std::ifstream in(graph_file, std::ios::binary);
+    #endif
+
+    graph_read=in && !slicer->read(in, goto_functions);
+  }
+
+  if(!graph_read)
+  {
+    // start over, as reading may have failed half-way
+    slicer=std::unique_ptr<full_slicert>(new full_slicert());
+    slicer->build(goto_functions, ns);
+
+    #ifdef _MSC_VER
+    std::ofstream out(widen(graph_file), std::ios::binary);
+    #else
+    std::ofstream out(graph_file, std::ios::binary);
+    #endif
+
+    if(!out)
+      throw "failed to write "+graph_file;
+
+    slicer->write(out);
+  }
+
+  property_slicer(*slicer, goto_functions, properties, slices);
+
+  return graph_read;
+}
+
+/*******************************************************************\
+
 Function: slicing_criteriont::~slicing_criteriont
 
   Inputs:
@@ -9,6 +9,8 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_GOTO_INSTRUMENT_FULL_SLICER_H
 #define CPROVER_GOTO_INSTRUMENT_FULL_SLICER_H
 
+#include <map>
+
 #include <goto-programs/goto_functions.h>
 
 void full_slicer(
@@ -20,6 +22,23 @@ void property_slicer(
   const namespacet &ns,
   const std::list<std::string> &properties);
 
+// one slice for each property, which shares the dependence graph
+void property_slicer(
+  const goto_functionst &goto_functions,
+  const namespacet &ns,
+  const std::list<std::string> &properties,
+  std::map<std::string, goto_functionst> &slices);
+
+// the same, with the dependence graph kept in a file, which
+// is only used if it was written for the same program;
+// returns true iff the graph was read from the file
+bool property_slicer(
+  const goto_functionst &goto_functions,
+  const namespacet &ns,
+  const std::list<std::string> &properties,
+  std::map<std::string, goto_functionst> &slices,
+  const std::string &graph_file);
+
 class slicing_criteriont
 {
 public:
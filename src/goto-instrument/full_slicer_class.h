@@ -9,6 +9,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_GOTO_INSTRUMENT_FULL_SLICER_CLASS_H
 #define CPROVER_GOTO_INSTRUMENT_FULL_SLICER_CLASS_H
 
+#include <iosfwd>
 #include <stack>
 #include <vector>
 #include <list>
@@ -30,8 +31,6 @@ echo 'digraph g {' > c.dot ; cat c.goto | \
   dot -Tpdf -oc-red.pdf c-red.dot
 #endif
 
-class dependence_grapht;
-
 /*******************************************************************\
 
    Class: full_slicert
@@ -48,6 +47,30 @@ public:
     const namespacet &ns,
     slicing_criteriont &criterion);
 
+  // Computes the CFG and the dependence graph of the program, which
+  // is then sliced for any number of criteria. The program must not
+  // change until the slicer is done with it.
+  void build(
+    const goto_functionst &goto_functions,
+    const namespacet &ns);
+
+  // Slices 'dest', which is a copy of the program given to build
+  // made with copy_from. Slicing the program itself removes
+  // instructions the slicer refers to, and must come last.
+  void slice(
+    slicing_criteriont &criterion,
+    goto_functionst &dest);
+
+  // The graph refers to the instructions by their position in the
+  // program, and can thus be written, and read for a program that
+  // is equal to the one it was built for. read returns true if it
+  // can't be read, or is for another program.
+  void write(std::ostream &out) const;
+
+  bool read(
+    std::istream &in,
+    const goto_functionst &goto_functions);
+
 protected:
   struct cfg_nodet
   {
@@ -64,23 +87,44 @@ protected:
   typedef cfg_baset<cfg_nodet> cfgt;
   cfgt cfg;
 
-  typedef std::vector<cfgt::entryt> dep_node_to_cfgt;
+  // the program given to build
+  const goto_functionst *program;
+
+  // The CFG nodes that node e depends on are
+  // dependencies[dependencies_begin[e]] to
+  // dependencies[dependencies_begin[e+1]-1].
+  std::vector<std::size_t> dependencies_begin;
+  std::vector<cfgt::entryt> dependencies;
+
+  // The same for the nodes that post-dominate node e, which
+  // are only needed for the jumps, and how many there are for
+  // any node.
+  std::vector<std::size_t> post_dominators_begin;
+  std::vector<cfgt::entryt> post_dominators;
+  std::vector<std::size_t> post_dominator_count;
+
+  bool is_jump(cfgt::entryt e) const
+  {
+    return (cfg[e].PC->is_goto() && cfg[e].PC->guard.is_true()) ||
+           cfg[e].PC->is_throw();
+  }
+
+  void get_positions(
+    const goto_functionst &goto_functions,
+    std::vector<std::pair<irep_idt, std::size_t> > &dest) const;
+
   typedef std::stack<cfgt::entryt> queuet;
   typedef std::list<cfgt::entryt> jumpst;
   typedef std::unordered_map<irep_idt, queuet, irep_id_hash> decl_deadt;
 
   void fixedpoint(
-    goto_functionst &goto_functions,
     queuet &queue,
     jumpst &jumps,
-    decl_deadt &decl_dead,
-    const dependence_grapht &dep_graph);
+    decl_deadt &decl_dead);
 
   void add_dependencies(
-    const cfgt::nodet &node,
-    queuet &queue,
-    const dependence_grapht &dep_graph,
-    const dep_node_to_cfgt &dep_node_to_cfg);
+    cfgt::entryt entry,
+    queuet &queue);
 
   void add_function_calls(
     const cfgt::nodet &node,
@@ -94,8 +138,7 @@ protected:
 
   void add_jumps(
     queuet &queue,
-    jumpst &jumps,
-    const cfg_post_dominatorst &cfg_post_dominators);
+    jumpst &jumps);
 
   void add_to_queue(
     queuet &queue,
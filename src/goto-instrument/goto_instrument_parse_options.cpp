@@ -410,8 +410,13 @@ int goto_instrument_parse_optionst::doit()
       status() << "Interval Analysis" << eom;
       namespacet ns(symbol_table);
       ait<interval_domaint> interval_analysis;
+      interval_analysis.use_summaries=cmdline.isset("function-summaries");
       interval_analysis(goto_functions, ns);
 
+      if(interval_analysis.use_summaries)
+        statistics() << "Function summaries reused: "
+                     << interval_analysis.summaries_reused << eom;
+
       interval_analysis.output(ns, goto_functions, std::cout);
       return 0;
     }
@@ -717,6 +722,23 @@ int goto_instrument_parse_optionst::doit()
       return 0;
     }
 
+    // write one binary per property?
+    if(cmdline.args.size()==2 && !property_slices.empty())
+    {
+      for(const auto &slice : property_slices)
+      {
+        const std::string file_name=cmdline.args[1]+"."+slice.first;
+
+        status() << "Writing GOTO program to `" << file_name << "'" << eom;
+
+        if(write_goto_binary(
+          file_name, symbol_table, slice.second, get_message_handler()))
+          return 1;
+      }
+
+      return 0;
+    }
+
     // write new binary?
     if(cmdline.args.size()==2)
     {
@@ -1106,7 +1128,12 @@ void goto_instrument_parse_optionst::instrument_goto_program()
 
     status() << "Propagating Constants" << eom;
 
-    constant_propagator_ait constant_propagator_ai(goto_functions, ns);
+    constant_propagator_ait constant_propagator_ai(
+      goto_functions, ns, cmdline.isset("function-summaries"));
+
+    if(constant_propagator_ai.use_summaries)
+      statistics() << "Function summaries reused: "
+                   << constant_propagator_ai.summaries_reused << eom;
 
     remove_skip(goto_functions);
   }
@@ -1406,7 +1433,36 @@ void goto_instrument_parse_optionst::instrument_goto_program()
     do_indirect_call_and_rtti_removal();
 
     status() << "Performing a full slice" << eom;
-    if(cmdline.isset("property"))
+    if(cmdline.isset("property-slices"))
+    {
+      if(!cmdline.isset("property"))
+        throw "--property-slices requires --property";
+
+      // the program itself is kept, the slices are written out
+      if(cmdline.isset("slice-graph"))
+      {
+        const std::string graph_file=cmdline.get_value("slice-graph");
+
+        if(property_slicer(
+             goto_functions,
+             ns,
+             cmdline.get_values("property"),
+             property_slices,
+             graph_file))
+          status() << "Read the dependence graph from `"
+                   << graph_file << "'" << eom;
+        else
+          status() << "Wrote the dependence graph to `"
+                   << graph_file << "'" << eom;
+      }
+      else
+        property_slicer(
+          goto_functions,
+          ns,
+          cmdline.get_values("property"),
+          property_slices);
+    }
+    else if(cmdline.isset("property"))
       property_slicer(goto_functions, ns, cmdline.get_values("property"));
     else
       full_slicer(goto_functions, ns);
@@ -1511,10 +1567,17 @@ void goto_instrument_parse_optionst::help()
     " --reachability-slice         slice away instructions that can't reach assertions\n" // NOLINT(*)
     " --full-slice                 slice away instructions that don't affect assertions\n" // NOLINT(*)
     " --property id                slice with respect to specific property only\n" // NOLINT(*)
+    " --property-slices            with --full-slice: write a slice for each\n" // NOLINT(*)
+    "                              --property to <out>.<property>\n" // NOLINT(*)
+    " --slice-graph file           with --property-slices: keep the dependence\n" // NOLINT(*)
+    "                              graph in the file, for the same program\n" // NOLINT(*)
     " --slice-global-inits         slice away initializations of unused global variables\n" // NOLINT(*)
     "\n"
     "Further transformations:\n"
     " --constant-propagator        propagate constants and simplify expressions\n" // NOLINT(*)
+    " --function-summaries         with --constant-propagator and --show-intervals:\n" // NOLINT(*)
+    "                              reuse the effect of functions called with\n" // NOLINT(*)
+    "                              equal states\n" // NOLINT(*)
     " --inline                     perform full inlining\n"
     " --partial-inline             perform partial inlining\n"
     " --function-inline <function> transitively inline all calls <function> makes\n" // NOLINT(*)
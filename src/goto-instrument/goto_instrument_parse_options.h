@@ -53,6 +53,7 @@ Author: Daniel Kroening, kroening@kroening.com
   "(show-struct-alignment)(interval-analysis)(show-intervals)" \
   "(show-uninitialized)(show-locations)" \
   "(full-slice)(reachability-slice)(slice-global-inits)" \
+  "(property-slices)(slice-graph):" \
   "(inline)(partial-inline)(function-inline):(log):" \
   "(remove-function-pointers)" \
   "(show-claims)(show-properties)(property):" \
@@ -61,7 +62,7 @@ Author: Daniel Kroening, kroening@kroening.com
   "(show-natural-loops)(accelerate)(havoc-loops)" \
   "(error-label):(string-abstraction)" \
   "(verbosity):(version)(xml-ui)(json-ui)(show-loops)" \
-  "(accelerate)(constant-propagator)" \
+  "(accelerate)(constant-propagator)(function-summaries)" \
   "(k-induction):(step-case)(base-case)" \
   "(show-call-sequences)(check-call-sequence)" \
   "(interpreter)(show-reaching-definitions)(count-eloc)(list-eloc)" \
@@ -105,6 +106,9 @@ protected:
   bool remove_returns_done;
 
   goto_functionst goto_functions;
+
+  // with --property-slices, a slice of goto_functions per property
+  std::map<std::string, goto_functionst> property_slices;
 };
 
 #endif // CPROVER_GOTO_INSTRUMENT_GOTO_INSTRUMENT_PARSE_OPTIONS_H
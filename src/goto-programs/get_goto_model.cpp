@@ -122,11 +122,15 @@ bool get_goto_modelt::operator()(const std::vector<std::string> &files)
       }
     }
 
-    for(const auto &file : binaries)
+    if(!binaries.empty())
     {
       status() << "Reading GOTO program from file" << eom;
 
-      if(read_object_and_link(file, *this, get_message_handler()))
+      if(read_objects_and_link(
+           binaries,
+           symbol_table,
+           goto_functions,
+           get_message_handler()))
         return true;
     }
 
@@ -8,15 +8,26 @@ Date: June 2003
 
 \*******************************************************************/
 
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 #include <cassert>
+#include <fstream>
 
 #include <util/base_type.h>
 #include <util/std_code.h>
 #include <util/symbol_table.h>
 #include <util/prefix.h>
+#include <util/irep_serialization.h>
+#include <util/message_buffer.h>
+#include <util/tempfile.h>
 
 #include "goto_convert_functions.h"
 #include "goto_inline.h"
+#include "read_bin_goto_object.h"
+#include "write_goto_binary.h"
 
 /*******************************************************************\
 
@@ -67,11 +78,10 @@ Function: goto_convert_functionst::goto_convert
 
 \*******************************************************************/
 
-void goto_convert_functionst::goto_convert()
+void goto_convert_functionst::goto_convert(unsigned workers)
 {
   // warning! hash-table iterators are not stable
 
-  typedef std::list<irep_idt> symbol_listt;
   symbol_listt symbol_list;
 
   forall_symbols(it, symbol_table.symbols)
@@ -86,9 +96,14 @@ void goto_convert_functionst::goto_convert()
       symbol_list.push_back(it->first);
   }
 
-  for(const auto &id : symbol_list)
+  if(workers>1 && symbol_list.size()>1)
+    convert_parallel(symbol_list, workers);
+  else
   {
-    convert_function(id);
+    for(const auto &id : symbol_list)
+    {
+      convert_function(id);
+    }
   }
 
   functions.compute_location_numbers();
@@ -107,6 +122,214 @@ void goto_convert_functionst::goto_convert()
 
 /*******************************************************************\
 
+Function: goto_convert_functionst::convert_parallel
+
+  Inputs: the functions to convert, number of worker processes
+
+ Outputs:
+
+ Purpose: Convert the functions in worker processes, which do not
+          share any ireps, and hence need no synchronisation. Each
+          worker converts a contiguous share of the functions and
+          writes the bodies and the symbols it adds into a goto
+          binary. These are merged in the order of the shares, which
+          yields the same result and the same messages as the
+          sequential conversion. The share of a worker that fails
+          is converted here, to report the error.
+
+\*******************************************************************/
+
+void goto_convert_functionst::convert_parallel(
+  const symbol_listt &symbol_list,
+  unsigned workers)
+{
+  #ifdef _WIN32
+  for(const auto &id : symbol_list)
+    convert_function(id);
+  #else
+  if(workers>symbol_list.size())
+    workers=symbol_list.size();
+
+  std::vector<symbol_listt> shares(workers);
+
+  std::size_t index=0;
+  for(const auto &id : symbol_list)
+  {
+    shares[index*workers/symbol_list.size()].push_back(id);
+    index++;
+  }
+
+  // the symbols of the workers are those not yet in the table
+  symbol_sett existing;
+  forall_symbols(it, symbol_table.symbols)
+    existing.insert(it->first);
+
+  std::list<temporary_filet> result_files;
+  std::vector<pid_t> pids;
+
+  for(const auto &share : shares)
+  {
+    result_files.emplace_back("goto_convert_", ".gb");
+
+    pid_t pid=fork();
+
+    if(pid==0)
+    {
+      // don't run destructors or flush streams of the parent
+      _exit(convert_worker(share, existing, result_files.back()())?1:0);
+    }
+
+    pids.push_back(pid);
+  }
+
+  std::vector<bool> succeeded;
+
+  for(const auto pid : pids)
+  {
+    int status;
+
+    succeeded.push_back(
+      pid>0 &&
+      waitpid(pid, &status, 0)==pid &&
+      WIFEXITED(status) &&
+      WEXITSTATUS(status)==0);
+  }
+
+  std::list<temporary_filet>::const_iterator file_it=result_files.begin();
+
+  for(std::size_t i=0; i<shares.size(); i++, file_it++)
+  {
+    if(succeeded[i] && !merge_worker_result(shares[i], (*file_it)()))
+      continue;
+
+    debug() << "Converting share " << i << " sequentially" << eom;
+
+    for(const auto &id : shares[i])
+      convert_function(id);
+  }
+  #endif
+}
+
+/*******************************************************************\
+
+Function: goto_convert_functionst::convert_worker
+
+  Inputs: the functions to convert, the symbols in the table
+          before conversion, file name for the result
+
+ Outputs: true on error
+
+ Purpose: runs in the worker process; writes the messages, the
+          new symbols, and the converted functions to the file
+
+\*******************************************************************/
+
+bool goto_convert_functionst::convert_worker(
+  const symbol_listt &share,
+  const symbol_sett &existing,
+  const std::string &result_file)
+{
+  message_buffert message_buffer;
+  set_message_handler(message_buffer);
+
+  try
+  {
+    for(const auto &id : share)
+      convert_function(id);
+  }
+
+  catch(...)
+  {
+    return true;
+  }
+
+  symbol_tablet new_symbols;
+
+  forall_symbols(it, symbol_table.symbols)
+    if(existing.find(it->first)==existing.end())
+      new_symbols.add(it->second);
+
+  goto_functionst converted;
+
+  for(const auto &id : share)
+    converted.function_map[id].swap(functions.function_map[id]);
+
+  std::ofstream out(result_file, std::ios::binary);
+
+  irep_serializationt::ireps_containert ic;
+  irep_serializationt irepconverter(ic);
+
+  message_buffer.write(out, irepconverter);
+
+  if(write_goto_binary(out, new_symbols, converted))
+    return true;
+
+  out.close();
+
+  return !out;
+}
+
+/*******************************************************************\
+
+Function: goto_convert_functionst::merge_worker_result
+
+  Inputs: the functions converted by the worker, the file
+          it has written
+
+ Outputs: true on error, in which case nothing has been changed
+
+ Purpose: passes on the messages of the worker, and adds its
+          symbols and functions
+
+\*******************************************************************/
+
+bool goto_convert_functionst::merge_worker_result(
+  const symbol_listt &share,
+  const std::string &result_file)
+{
+  std::ifstream in(result_file, std::ios::binary);
+
+  irep_serializationt::ireps_containert ic;
+  irep_serializationt irepconverter(ic);
+
+  message_buffert message_buffer;
+  message_buffer.read(in, irepconverter);
+
+  symbol_tablet new_symbols;
+  goto_functionst converted;
+  null_message_handlert null_message_handler;
+
+  if(!in ||
+     read_bin_goto_object(
+       in, result_file, new_symbols, converted, null_message_handler))
+    return true;
+
+  message_buffer.replay(get_message_handler());
+
+  forall_symbols(it, new_symbols.symbols)
+    symbol_table.add(it->second);
+
+  for(const auto &id : share)
+  {
+    goto_functionst::goto_functiont &f=functions.function_map[id];
+    goto_functionst::goto_functiont &c=converted.function_map[id];
+
+    f.type=to_code_type(ns.lookup(id).type);
+
+    if(c.body_available())
+    {
+      f.body.swap(c.body);
+
+      if(c.is_hidden())
+        f.make_hidden();
+    }
+  }
+
+  return false;
+}
+
+/*******************************************************************\
+
 Function: goto_convert_functionst::hide
 
   Inputs:
@@ -329,13 +552,35 @@ void goto_convert(
   symbol_tablet &symbol_table,
   goto_functionst &functions,
   message_handlert &message_handler)
+{
+  goto_convert(symbol_table, functions, message_handler, 1);
+}
+
+/*******************************************************************\
+
+Function: goto_convert
+
+  Inputs: symbol table, functions, message handler,
+          number of worker processes
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void goto_convert(
+  symbol_tablet &symbol_table,
+  goto_functionst &functions,
+  message_handlert &message_handler,
+  unsigned workers)
 {
   goto_convert_functionst goto_convert_functions(
     symbol_table, functions, message_handler);
 
   try
   {
-    goto_convert_functions.goto_convert();
+    goto_convert_functions.goto_convert(workers);
   }
 
   catch(int)
@@ -11,6 +11,9 @@ Date: June 2003
 #ifndef CPROVER_GOTO_PROGRAMS_GOTO_CONVERT_FUNCTIONS_H
 #define CPROVER_GOTO_PROGRAMS_GOTO_CONVERT_FUNCTIONS_H
 
+#include <list>
+#include <unordered_set>
+
 #include "goto_model.h"
 #include "goto_convert_class.h"
 
@@ -26,6 +29,13 @@ void goto_convert(
   goto_modelt &dest,
   message_handlert &message_handler);
 
+// convert it all, using the given number of worker processes
+void goto_convert(
+  symbol_tablet &symbol_table,
+  goto_functionst &functions,
+  message_handlert &message_handler,
+  unsigned workers);
+
 // just convert a specific function
 void goto_convert(
   const irep_idt &identifier,
@@ -36,7 +46,7 @@ void goto_convert(
 class goto_convert_functionst:public goto_convertt
 {
 public:
-  void goto_convert();
+  void goto_convert(unsigned workers=1);
   void convert_function(const irep_idt &identifier);
 
   goto_convert_functionst(
@@ -49,6 +59,21 @@ public:
 protected:
   goto_functionst &functions;
 
+  typedef std::list<irep_idt> symbol_listt;
+
+  void convert_parallel(const symbol_listt &symbol_list, unsigned workers);
+
+  typedef std::unordered_set<irep_idt, irep_id_hash> symbol_sett;
+
+  bool convert_worker(
+    const symbol_listt &share,
+    const symbol_sett &existing,
+    const std::string &result_file);
+
+  bool merge_worker_result(
+    const symbol_listt &share,
+    const std::string &result_file);
+
   static bool hide(const goto_programt &goto_program);
 
   //
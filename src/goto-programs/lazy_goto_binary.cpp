@@ -0,0 +1,411 @@
+/*******************************************************************\
+
+Module: Read Goto Binaries, Loading Function Bodies on Demand
+
+Author:
+
+\*******************************************************************/
+
+#if defined(__linux__) || \
+    defined(__FreeBSD_kernel__) || \
+    defined(__GNU__) || \
+    defined(__unix__) || \
+    defined(__CYGWIN__) || \
+    defined(__MACH__)
+#define HAVE_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <fstream>
+#include <istream>
+#include <streambuf>
+
+#include <util/find_symbols.h>
+#include <util/irep_serialization.h>
+#include <util/unicode.h>
+
+#include "read_bin_goto_object.h"
+#include "read_goto_binary.h"
+#include "lazy_goto_binary.h"
+
+/*******************************************************************\
+
+   Class: memory_streambuft
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: lets an istream read from a range of memory
+
+\*******************************************************************/
+
+class memory_streambuft:public std::streambuf
+{
+public:
+  memory_streambuft(const char *begin, std::size_t size)
+  {
+    char *b=const_cast<char *>(begin);
+    setg(b, b, b+size);
+  }
+
+  std::size_t position() const
+  {
+    return gptr()-eback();
+  }
+};
+
+/*******************************************************************\
+
+Function: lazy_goto_binaryt::~lazy_goto_binaryt
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+lazy_goto_binaryt::~lazy_goto_binaryt()
+{
+  unmap_file();
+}
+
+/*******************************************************************\
+
+Function: lazy_goto_binaryt::map_file
+
+  Inputs: file name
+
+ Outputs: true on error
+
+ Purpose: make the contents of the file available in 'data'
+
+\*******************************************************************/
+
+bool lazy_goto_binaryt::map_file(const std::string &filename)
+{
+  #ifdef HAVE_MMAP
+  int fd=open(filename.c_str(), O_RDONLY);
+
+  if(fd>=0)
+  {
+    struct stat st;
+
+    if(fstat(fd, &st)==0 && st.st_size>0)
+    {
+      void *p=mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+      if(p!=MAP_FAILED)
+      {
+        close(fd);
+        data=static_cast<const char *>(p);
+        size=st.st_size;
+        mapped=true;
+        return false;
+      }
+    }
+
+    close(fd);
+  }
+  #endif
+
+  // read it instead
+  #ifdef _MSC_VER
+  std::ifstream in(widen(filename), std::ios::binary);
+  #else
+  std::ifstream in(filename, std::ios::binary);
+  #endif
+
+  if(!in)
+    return true;
+
+  buffer.assign(
+    std::istreambuf_iterator<char>(in),
+    std::istreambuf_iterator<char>());
+
+  data=buffer.data();
+  size=buffer.size();
+  return false;
+}
+
+/*******************************************************************\
+
+Function: lazy_goto_binaryt::unmap_file
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void lazy_goto_binaryt::unmap_file()
+{
+  #ifdef HAVE_MMAP
+  if(mapped)
+    munmap(const_cast<char *>(data), size);
+  #endif
+
+  mapped=false;
+  buffer.clear();
+  data=NULL;
+  size=0;
+  index.clear();
+}
+
+/*******************************************************************\
+
+Function: lazy_goto_binaryt::read
+
+  Inputs: file name
+
+ Outputs: true on error
+
+ Purpose: read the symbol table, and the function index if
+          the file is a goto binary in version 4, and otherwise
+          everything
+
+\*******************************************************************/
+
+bool lazy_goto_binaryt::read(const std::string &filename)
+{
+  unmap_file();
+
+  if(map_file(filename))
+  {
+    error() << "Failed to open `" << filename << "'" << eom;
+    return true;
+  }
+
+  const std::size_t header_size=4;
+
+  bool is_v4=
+    size>=header_size &&
+    data[0]==0x7f && data[1]=='G' && data[2]=='B' && data[3]=='F';
+
+  memory_streambuft streambuf(
+    data+header_size, is_v4?size-header_size:0);
+  std::istream in(&streambuf);
+
+  irep_serializationt::ireps_containert ic;
+  irep_serializationt irepconverter(ic);
+
+  if(is_v4)
+    is_v4=irepconverter.read_gb_word(in)==4;
+
+  if(!is_v4)
+  {
+    unmap_file();
+    return read_goto_binary(
+      filename, symbol_table, goto_functions, get_message_handler());
+  }
+
+  bin_goto_function_indext bin_index;
+
+  try
+  {
+    read_bin_goto_symbols(in, symbol_table, goto_functions, irepconverter);
+    read_bin_goto_function_index(in, bin_index, irepconverter);
+  }
+
+  catch(int)
+  {
+    in.setstate(std::ios::failbit);
+  }
+
+  if(!in)
+  {
+    error() << "`" << filename << "' is corrupted" << eom;
+    return true;
+  }
+
+  const std::size_t start=header_size+streambuf.position();
+
+  for(const auto &entry : bin_index)
+  {
+    if(start+entry.offset+entry.size>size)
+    {
+      error() << "`" << filename << "' is corrupted" << eom;
+      return true;
+    }
+
+    entryt &e=index[entry.name];
+    e.offset=start+entry.offset;
+    e.size=entry.size;
+    e.loaded=false;
+  }
+
+  statistics() << "Function index of `" << filename << "' has "
+               << index.size() << " entries" << eom;
+
+  return false;
+}
+
+/*******************************************************************\
+
+Function: lazy_goto_binaryt::load
+
+  Inputs: function identifier
+
+ Outputs: true if the file has no body for the function,
+          or if the body is corrupted
+
+ Purpose: read the body of the function, unless done already;
+          the caller needs to recompute the location numbers
+
+\*******************************************************************/
+
+bool lazy_goto_binaryt::load(const irep_idt &identifier)
+{
+  indext::iterator entry=index.find(identifier);
+
+  if(entry==index.end())
+    return true;
+
+  if(entry->second.loaded)
+    return false;
+
+  memory_streambuft streambuf(data+entry->second.offset, entry->second.size);
+  std::istream in(&streambuf);
+
+  // each body is serialized on its own
+  irep_serializationt::ireps_containert ic;
+  irep_serializationt irepconverter(ic);
+
+  goto_functionst::goto_functiont &goto_function=
+    goto_functions.function_map[identifier];
+
+  try
+  {
+    read_bin_goto_function(in, goto_function, irepconverter);
+  }
+
+  catch(int)
+  {
+    in.setstate(std::ios::failbit);
+  }
+
+  // the body must take up exactly the space given in the index
+  if(!in || streambuf.position()!=entry->second.size)
+  {
+    goto_function.body.clear();
+    error() << "the body of `" << identifier << "' is corrupted" << eom;
+    return true;
+  }
+
+  entry->second.loaded=true;
+
+  return false;
+}
+
+/*******************************************************************\
+
+Function: lazy_goto_binaryt::load_all
+
+  Inputs:
+
+ Outputs: true on error
+
+ Purpose:
+
+\*******************************************************************/
+
+bool lazy_goto_binaryt::load_all()
+{
+  for(const auto &entry : index)
+    if(load(entry.first))
+      return true;
+
+  goto_functions.compute_location_numbers();
+
+  return false;
+}
+
+/*******************************************************************\
+
+Function: lazy_goto_binaryt::load_reachable
+
+  Inputs: the entry point
+
+ Outputs: true on error
+
+ Purpose: Load the functions that may be called, directly or via
+          function pointers, starting from the entry point. This
+          over-approximates what remove_unused_functions keeps.
+
+\*******************************************************************/
+
+bool lazy_goto_binaryt::load_reachable(const irep_idt &entry)
+{
+  if(index.find(entry)==index.end())
+    return load_all();
+
+  std::vector<irep_idt> queue;
+  queue.push_back(entry);
+
+  while(!queue.empty())
+  {
+    irep_idt identifier=queue.back();
+    queue.pop_back();
+
+    indext::const_iterator i_it=index.find(identifier);
+    if(i_it==index.end() || i_it->second.loaded)
+      continue;
+
+    if(load(identifier))
+      return true;
+
+    // any mention of a function may lead to a call
+    find_symbols_sett symbols;
+
+    forall_goto_program_instructions(
+      it, goto_functions.function_map[identifier].body)
+    {
+      find_symbols(it->code, symbols);
+      find_symbols(it->guard, symbols);
+    }
+
+    for(const auto &s : symbols)
+    {
+      i_it=index.find(s);
+      if(i_it!=index.end() && !i_it->second.loaded)
+        queue.push_back(s);
+    }
+  }
+
+  goto_functions.compute_location_numbers();
+
+  statistics() << "Loaded " << (index.size()-number_of_unloaded_functions())
+               << " of " << index.size() << " function bodies" << eom;
+
+  return false;
+}
+
+/*******************************************************************\
+
+Function: lazy_goto_binaryt::number_of_unloaded_functions
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+std::size_t lazy_goto_binaryt::number_of_unloaded_functions() const
+{
+  std::size_t result=0;
+
+  for(const auto &entry : index)
+    if(!entry.second.loaded)
+      result++;
+
+  return result;
+}
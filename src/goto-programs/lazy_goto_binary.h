@@ -0,0 +1,96 @@
+/*******************************************************************\
+
+Module: Read Goto Binaries, Loading Function Bodies on Demand
+
+Author:
+
+\*******************************************************************/
+
+#ifndef CPROVER_GOTO_PROGRAMS_LAZY_GOTO_BINARY_H
+#define CPROVER_GOTO_PROGRAMS_LAZY_GOTO_BINARY_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <util/message.h>
+
+#include "goto_functions.h"
+
+class symbol_tablet;
+
+/*******************************************************************\
+
+   Class: lazy_goto_binaryt
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Reads the symbol table and the function index of a goto
+          binary in version 4. The file is mapped into memory,
+          and function bodies are only read when asked for.
+          Other goto binaries are read entirely.
+
+\*******************************************************************/
+
+class lazy_goto_binaryt:public messaget
+{
+public:
+  lazy_goto_binaryt(
+    symbol_tablet &_symbol_table,
+    goto_functionst &_goto_functions,
+    message_handlert &_message_handler):
+    messaget(_message_handler),
+    symbol_table(_symbol_table),
+    goto_functions(_goto_functions),
+    data(NULL),
+    size(0),
+    mapped(false)
+  {
+  }
+
+  ~lazy_goto_binaryt();
+
+  // returns true on error
+  bool read(const std::string &filename);
+
+  // returns true if there is no such body in the file,
+  // or if it can't be read
+  bool load(const irep_idt &identifier);
+
+  // returns true on error
+  bool load_all();
+
+  // loads the bodies of the functions whose symbol is
+  // mentioned in the body of a loaded function, starting
+  // from the given one; falls back to loading all bodies
+  // if there is no such function; returns true on error
+  bool load_reachable(const irep_idt &entry);
+
+  std::size_t number_of_unloaded_functions() const;
+
+protected:
+  symbol_tablet &symbol_table;
+  goto_functionst &goto_functions;
+
+  // the contents of the file
+  const char *data;
+  std::size_t size;
+  bool mapped;
+  std::vector<char> buffer;
+
+  struct entryt
+  {
+    std::size_t offset, size;
+    bool loaded;
+  };
+
+  typedef std::map<irep_idt, entryt> indext;
+  indext index;
+
+  bool map_file(const std::string &filename);
+  void unmap_file();
+};
+
+#endif // CPROVER_GOTO_PROGRAMS_LAZY_GOTO_BINARY_H
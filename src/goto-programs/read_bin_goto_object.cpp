@@ -18,22 +18,21 @@ Date: June 2006
 
 /*******************************************************************\
 
-Function: read_goto_object_v3
+Function: read_bin_goto_symbols
 
   Inputs: input stream, symbol_table, functions
 
- Outputs: true on error, false otherwise
+ Outputs:
 
- Purpose: read goto binary format v3
+ Purpose: read the symbol table, as in versions 3 and 4; adds
+          a function without body for every function symbol
 
 \*******************************************************************/
 
-bool read_bin_goto_object_v3(
+void read_bin_goto_symbols(
   std::istream &in,
-  const std::string &filename,
   symbol_tablet &symbol_table,
   goto_functionst &functions,
-  message_handlert &message_handler,
   irep_serializationt &irepconverter)
 {
   std::size_t count = irepconverter.read_gb_word(in); // # of symbols
@@ -85,82 +84,205 @@ bool read_bin_goto_object_v3(
 
     symbol_table.add(sym);
   }
+}
 
-  count=irepconverter.read_gb_word(in); // # of functions
+/*******************************************************************\
 
-  for(std::size_t i=0; i<count; i++)
-  {
-    irep_idt fname=irepconverter.read_gb_string(in);
-    goto_functionst::goto_functiont &f = functions.function_map[fname];
+Function: read_bin_goto_function
+
+  Inputs: input stream, function
+
+ Outputs:
+
+ Purpose: read the body of a function, as in versions 3 and 4
 
-    typedef std::map<goto_programt::targett, std::list<unsigned> > target_mapt;
-    target_mapt target_map;
-    typedef std::map<unsigned, goto_programt::targett> rev_target_mapt;
-    rev_target_mapt rev_target_map;
+\*******************************************************************/
 
-    bool hidden=false;
+void read_bin_goto_function(
+  std::istream &in,
+  goto_functionst::goto_functiont &f,
+  irep_serializationt &irepconverter)
+{
+  typedef std::map<goto_programt::targett, std::list<unsigned> > target_mapt;
+  target_mapt target_map;
+  typedef std::map<unsigned, goto_programt::targett> rev_target_mapt;
+  rev_target_mapt rev_target_map;
 
-    std::size_t ins_count = irepconverter.read_gb_word(in); // # of instructions
-    for(std::size_t i=0; i<ins_count; i++)
+  bool hidden=false;
+
+  std::size_t ins_count = irepconverter.read_gb_word(in); // # of instructions
+  for(std::size_t i=0; i<ins_count; i++)
+  {
+    goto_programt::targett itarget = f.body.add_instruction();
+    goto_programt::instructiont &instruction=*itarget;
+
+    irepconverter.reference_convert(in, instruction.code);
+    instruction.function = irepconverter.read_string_ref(in);
+    irepconverter.reference_convert(in, instruction.source_location);
+    instruction.type = (goto_program_instruction_typet)
+                            irepconverter.read_gb_word(in);
+    instruction.guard.make_nil();
+    irepconverter.reference_convert(in, instruction.guard);
+    irepconverter.read_string_ref(in); // former event
+    instruction.target_number = irepconverter.read_gb_word(in);
+    if(instruction.is_target() &&
+       rev_target_map.insert(
+         rev_target_map.end(),
+         std::make_pair(instruction.target_number, itarget))->second!=itarget)
+      assert(false);
+
+    std::size_t t_count = irepconverter.read_gb_word(in); // # of targets
+    for(std::size_t i=0; i<t_count; i++)
+      // just save the target numbers
+      target_map[itarget].push_back(irepconverter.read_gb_word(in));
+
+    std::size_t l_count = irepconverter.read_gb_word(in); // # of labels
+
+    for(std::size_t i=0; i<l_count; i++)
     {
-      goto_programt::targett itarget = f.body.add_instruction();
-      goto_programt::instructiont &instruction=*itarget;
-
-      irepconverter.reference_convert(in, instruction.code);
-      instruction.function = irepconverter.read_string_ref(in);
-      irepconverter.reference_convert(in, instruction.source_location);
-      instruction.type = (goto_program_instruction_typet)
-                              irepconverter.read_gb_word(in);
-      instruction.guard.make_nil();
-      irepconverter.reference_convert(in, instruction.guard);
-      irepconverter.read_string_ref(in); // former event
-      instruction.target_number = irepconverter.read_gb_word(in);
-      if(instruction.is_target() &&
-         rev_target_map.insert(
-           rev_target_map.end(),
-           std::make_pair(instruction.target_number, itarget))->second!=itarget)
-        assert(false);
-
-      std::size_t t_count = irepconverter.read_gb_word(in); // # of targets
-      for(std::size_t i=0; i<t_count; i++)
-        // just save the target numbers
-        target_map[itarget].push_back(irepconverter.read_gb_word(in));
-
-      std::size_t l_count = irepconverter.read_gb_word(in); // # of labels
-
-      for(std::size_t i=0; i<l_count; i++)
-      {
-        irep_idt label=irepconverter.read_string_ref(in);
-        instruction.labels.push_back(label);
-        if(label=="__CPROVER_HIDE")
-          hidden=true;
-        // The above info is normally in the type of the goto_functiont object,
-        // which should likely be stored in the binary.
-      }
+      irep_idt label=irepconverter.read_string_ref(in);
+      instruction.labels.push_back(label);
+      if(label=="__CPROVER_HIDE")
+        hidden=true;
+      // The above info is normally in the type of the goto_functiont object,
+      // which should likely be stored in the binary.
     }
+  }
 
-    // Resolve targets
-    for(target_mapt::iterator tit = target_map.begin();
-        tit!=target_map.end();
-        tit++)
-    {
-      goto_programt::targett ins = tit->first;
+  // Resolve targets
+  for(target_mapt::iterator tit = target_map.begin();
+      tit!=target_map.end();
+      tit++)
+  {
+    goto_programt::targett ins = tit->first;
 
-      for(std::list<unsigned>::iterator nit = tit->second.begin();
-          nit!=tit->second.end();
-          nit++)
-      {
-        unsigned n=*nit;
-        rev_target_mapt::const_iterator entry=rev_target_map.find(n);
-        assert(entry!=rev_target_map.end());
-        ins->targets.push_back(entry->second);
-      }
+    for(std::list<unsigned>::iterator nit = tit->second.begin();
+        nit!=tit->second.end();
+        nit++)
+    {
+      unsigned n=*nit;
+      rev_target_mapt::const_iterator entry=rev_target_map.find(n);
+      assert(entry!=rev_target_map.end());
+      ins->targets.push_back(entry->second);
     }
+  }
+
+  f.body.update();
+
+  if(hidden)
+    f.make_hidden();
+}
+
+/*******************************************************************\
+
+Function: read_bin_goto_function_index
+
+  Inputs: input stream
+
+ Outputs: the index
+
+ Purpose: read the function index of version 4
+
+\*******************************************************************/
+
+void read_bin_goto_function_index(
+  std::istream &in,
+  bin_goto_function_indext &index,
+  irep_serializationt &irepconverter)
+{
+  std::size_t count=irepconverter.read_gb_word(in); // # of functions
 
-    f.body.update();
+  index.resize(count);
 
-    if(hidden)
-      f.make_hidden();
+  for(auto &entry : index)
+  {
+    entry.name=irepconverter.read_gb_string(in);
+    entry.offset=irepconverter.read_gb_word(in);
+    entry.size=irepconverter.read_gb_word(in);
+  }
+}
+
+/*******************************************************************\
+
+Function: read_goto_object_v3
+
+  Inputs: input stream, symbol_table, functions
+
+ Outputs: true on error, false otherwise
+
+ Purpose: read goto binary format v3
+
+\*******************************************************************/
+
+bool read_bin_goto_object_v3(
+  std::istream &in,
+  const std::string &filename,
+  symbol_tablet &symbol_table,
+  goto_functionst &functions,
+  message_handlert &message_handler,
+  irep_serializationt &irepconverter)
+{
+  read_bin_goto_symbols(in, symbol_table, functions, irepconverter);
+
+  std::size_t count=irepconverter.read_gb_word(in); // # of functions
+
+  for(std::size_t i=0; i<count; i++)
+  {
+    irep_idt fname=irepconverter.read_gb_string(in);
+    read_bin_goto_function(in, functions.function_map[fname], irepconverter);
+  }
+
+  functions.compute_location_numbers();
+
+  return false;
+}
+
+/*******************************************************************\
+
+Function: read_goto_object_v4
+
+  Inputs: input stream, symbol_table, functions
+
+ Outputs: true on error, false otherwise
+
+ Purpose: read goto binary format v4, which is v3 plus an index
+          of the function bodies, each of which is serialized
+          on its own
+
+\*******************************************************************/
+
+bool read_bin_goto_object_v4(
+  std::istream &in,
+  const std::string &filename,
+  symbol_tablet &symbol_table,
+  goto_functionst &functions,
+  message_handlert &message_handler,
+  irep_serializationt &irepconverter)
+{
+  read_bin_goto_symbols(in, symbol_table, functions, irepconverter);
+
+  bin_goto_function_indext index;
+  read_bin_goto_function_index(in, index, irepconverter);
+
+  // the bodies follow the index, in the same order
+  for(const auto &entry : index)
+  {
+    if(!in)
+      break;
+
+    irep_serializationt::ireps_containert ic;
+    irep_serializationt body_converter(ic);
+
+    read_bin_goto_function(
+      in, functions.function_map[entry.name], body_converter);
+  }
+
+  if(!in)
+  {
+    messaget message(message_handler);
+    message.error() << "`" << filename << "' is corrupted"
+                    << messaget::eom;
+    return true;
   }
 
   functions.compute_location_numbers();
@@ -249,6 +371,13 @@ bool read_bin_goto_object(
                                      irepconverter);
       break;
 
+    case 4:
+      return read_bin_goto_object_v4(in, filename,
+                                     symbol_table, functions,
+                                     message_handler,
+                                     irepconverter);
+      break;
+
     default:
       message.error() <<
           "The input was compiled with an unsupported version of "
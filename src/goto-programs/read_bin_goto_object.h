@@ -13,10 +13,13 @@ Date: May 2007
 
 #include <iosfwd>
 #include <string>
+#include <vector>
+
+#include "goto_functions.h"
 
 class symbol_tablet;
-class goto_functionst;
 class message_handlert;
+class irep_serializationt;
 
 bool read_bin_goto_object(
   std::istream &in,
@@ -25,4 +28,32 @@ bool read_bin_goto_object(
   goto_functionst &goto_functions,
   message_handlert &message_handler);
 
+// the building blocks, shared with lazy_goto_binaryt
+
+void read_bin_goto_symbols(
+  std::istream &in,
+  symbol_tablet &symbol_table,
+  goto_functionst &goto_functions,
+  irep_serializationt &irepconverter);
+
+void read_bin_goto_function(
+  std::istream &in,
+  goto_functionst::goto_functiont &goto_function,
+  irep_serializationt &irepconverter);
+
+// version 4: where to find the function bodies, relative
+// to the end of the index
+struct bin_goto_function_index_entryt
+{
+  irep_idt name;
+  std::size_t offset, size;
+};
+
+typedef std::vector<bin_goto_function_index_entryt> bin_goto_function_indext;
+
+void read_bin_goto_function_index(
+  std::istream &in,
+  bin_goto_function_indext &index,
+  irep_serializationt &irepconverter);
+
 #endif // CPROVER_GOTO_PROGRAMS_READ_BIN_GOTO_OBJECT_H
@@ -16,6 +16,8 @@ Author:
 #endif
 
 #include <fstream>
+#include <list>
+#include <thread>
 #include <unordered_set>
 
 #include <util/message.h>
@@ -271,6 +273,92 @@ static void rename_symbols_in_function(
   }
 }
 
+/*******************************************************************\
+
+   Class: link_statet
+
+ Purpose: What the linking of an object needs to know about the
+          symbols that have been linked already. It's kept up to
+          date while linking a series of objects, which saves
+          looking at all of them again for every object.
+
+\*******************************************************************/
+
+class link_statet
+{
+public:
+  typedef std::unordered_set<irep_idt, irep_id_hash> id_sett;
+
+  explicit link_statet(const symbol_tablet &symbol_table):
+    macro_chains(false)
+  {
+    forall_symbols(it, symbol_table.symbols)
+      update(it->second);
+  }
+
+  id_sett weak_symbols;
+
+  // the macros, i.e., the aliases, as a renaming
+  rename_symbolt macros;
+
+  // true if a macro is an alias of a macro; these are applied
+  // to all functions after each object, as the renaming only
+  // takes one step at a time
+  bool macro_chains;
+
+  // the targets of the macros
+  id_sett macro_targets;
+
+  // returns true iff the symbol is a macro that is new, or that
+  // has a new target
+  bool update(const symbolt &symbol);
+};
+
+/*******************************************************************\
+
+Function: link_statet::update
+
+  Inputs: a symbol that has been linked
+
+ Outputs: true iff the symbol is a macro that is new, or that has
+          a new target
+
+ Purpose:
+
+\*******************************************************************/
+
+bool link_statet::update(const symbolt &symbol)
+{
+  if(symbol.is_weak)
+    weak_symbols.insert(symbol.name);
+  else
+    weak_symbols.erase(symbol.name);
+
+  if(!symbol.is_macro)
+  {
+    macros.expr_map.erase(symbol.name);
+    return false;
+  }
+
+  assert(symbol.value.id()==ID_symbol);
+  const irep_idt &id=to_symbol_expr(symbol.value).get_identifier();
+
+  irep_idt &target=macros.expr_map[symbol.name];
+
+  if(target==id)
+    return false;
+
+  target=id;
+
+  if(macro_targets.find(symbol.name)!=macro_targets.end() ||
+     macros.expr_map.find(id)!=macros.expr_map.end())
+    macro_chains=true;
+
+  macro_targets.insert(id);
+
+  return true;
+}
+
 /*******************************************************************\
 
 Function: link_functions
@@ -279,7 +367,9 @@ Function: link_functions
 
  Outputs:
 
- Purpose:
+ Purpose: The functions of the destination that haven't changed
+          have had all earlier macros applied already, and thus
+          only need the ones that are new.
 
 \*******************************************************************/
 
@@ -289,11 +379,14 @@ static bool link_functions(
   const symbol_tablet &src_symbol_table,
   goto_functionst &src_functions,
   const rename_symbolt &rename_symbol,
-  const std::unordered_set<irep_idt, irep_id_hash> &weak_symbols)
+  link_statet &state)
 {
   namespacet ns(dest_symbol_table);
   namespacet src_ns(src_symbol_table);
 
+  // the functions that got a new body
+  link_statet::id_sett changed;
+
   // merge functions
   Forall_goto_functions(src_it, src_functions)
   {
@@ -319,22 +412,24 @@ static bool link_functions(
 
       in_dest_symbol_table.body.swap(src_it->second.body);
       in_dest_symbol_table.type=src_it->second.type;
+      changed.insert(final_id);
     }
     else // collision!
     {
       goto_functionst::goto_functiont &in_dest_symbol_table=
-        dest_functions.function_map[final_id];
+        dest_f_it->second;
 
       goto_functionst::goto_functiont &src_func=src_it->second;
 
       if(in_dest_symbol_table.body.instructions.empty() ||
-         weak_symbols.find(final_id)!=weak_symbols.end())
+         state.weak_symbols.find(final_id)!=state.weak_symbols.end())
       {
         // the one with body wins!
         rename_symbols_in_function(src_func, rename_symbol);
 
         in_dest_symbol_table.body.swap(src_func.body);
         in_dest_symbol_table.type=src_func.type;
+        changed.insert(final_id);
       }
       else if(src_func.body.instructions.empty() ||
               src_ns.lookup(src_it->first).is_weak)
@@ -354,32 +449,86 @@ static bool link_functions(
     }
   }
 
-  // apply macros
-  rename_symbolt macro_application;
+  // update the state with the symbols of this object
+  rename_symbolt new_macros;
 
-  forall_symbols(it, dest_symbol_table.symbols)
-    if(it->second.is_macro)
-    {
-      const symbolt &symbol=it->second;
+  forall_symbols(it, src_symbol_table.symbols)
+  {
+    // the symbol might have been renamed
+    rename_symbolt::expr_mapt::const_iterator e_it=
+      rename_symbol.expr_map.find(it->first);
 
-      assert(symbol.value.id()==ID_symbol);
-      const irep_idt &id=to_symbol_expr(symbol.value).get_identifier();
+    const irep_idt &final_id=
+      e_it==rename_symbol.expr_map.end()?it->first:e_it->second;
 
-      #if 0
-      if(!base_type_eq(symbol.type, ns.lookup(id).type, ns))
-      {
-        std::cerr << symbol << std::endl;
-        std::cerr << ns.lookup(id) << std::endl;
-      }
-      assert(base_type_eq(symbol.type, ns.lookup(id).type, ns));
-      #endif
+    symbol_tablet::symbolst::const_iterator d_it=
+      dest_symbol_table.symbols.find(final_id);
 
-      macro_application.insert_expr(symbol.name, id);
-    }
+    if(d_it!=dest_symbol_table.symbols.end() &&
+       state.update(d_it->second))
+      new_macros.insert_expr(
+        d_it->first,
+        state.macros.expr_map[d_it->first]);
+  }
 
-  if(!macro_application.expr_map.empty())
+  // apply macros
+  if(state.macro_chains || !new_macros.empty())
+  {
     Forall_goto_functions(dest_it, dest_functions)
-      rename_symbols_in_function(dest_it->second, macro_application);
+    {
+      if(state.macro_chains ||
+         changed.find(dest_it->first)!=changed.end())
+        rename_symbols_in_function(dest_it->second, state.macros);
+      else
+        rename_symbols_in_function(dest_it->second, new_macros);
+    }
+  }
+  else if(!state.macros.empty())
+  {
+    for(const auto &id : changed)
+      rename_symbols_in_function(
+        dest_functions.function_map[id],
+        state.macros);
+  }
+
+  return false;
+}
+
+/*******************************************************************\
+
+Function: link_object
+
+  Inputs: an object that has been read, the symbols of it that are
+          known to be identical to the ones of the destination, and
+          the state of the linking
+
+ Outputs: true on error, false otherwise
+
+ Purpose: links an object into the destination
+
+\*******************************************************************/
+
+static bool link_object(
+  symbol_tablet &symbol_table,
+  goto_functionst &functions,
+  goto_modelt &object,
+  const linkingt::id_sett *identical_symbols,
+  link_statet &state,
+  message_handlert &message_handler)
+{
+  linkingt linking(symbol_table,
+                   object.symbol_table,
+                   message_handler);
+
+  linking.identical_symbols=identical_symbols;
+
+  if(linking.typecheck_main())
+    return true;
+
+  if(link_functions(symbol_table, functions,
+                    object.symbol_table, object.goto_functions,
+                    linking.rename_symbol, state))
+    return true;
 
   return false;
 }
@@ -388,7 +537,7 @@ static bool link_functions(
 
 Function: read_object_and_link
 
-  Inputs: a file_name
+  Inputs: a file_name, and the state of the linking
 
  Outputs: true on error, false otherwise
 
@@ -396,10 +545,11 @@ Function: read_object_and_link
 
 \*******************************************************************/
 
-bool read_object_and_link(
+static bool read_object_and_link(
   const std::string &file_name,
   symbol_tablet &symbol_table,
   goto_functionst &functions,
+  link_statet &state,
   message_handlert &message_handler)
 {
   messaget(message_handler).statistics() << "Reading: "
@@ -414,23 +564,364 @@ bool read_object_and_link(
       message_handler))
     return true;
 
-  typedef std::unordered_set<irep_idt, irep_id_hash> id_sett;
-  id_sett weak_symbols;
-  forall_symbols(it, symbol_table.symbols)
-    if(it->second.is_weak)
-      weak_symbols.insert(it->first);
+  return link_object(
+    symbol_table,
+    functions,
+    temp_model,
+    nullptr,
+    state,
+    message_handler);
+}
 
-  linkingt linking(symbol_table,
-                   temp_model.symbol_table,
-                   message_handler);
 
-  if(linking.typecheck_main())
-    return true;
+/*******************************************************************\
 
-  if(link_functions(symbol_table, functions,
-                    temp_model.symbol_table, temp_model.goto_functions,
-                    linking.rename_symbol, weak_symbols))
-    return true;
+Function: read_object_and_link
+
+  Inputs: a file_name
+
+ Outputs: true on error, false otherwise
+
+ Purpose: reads an object file
+
+\*******************************************************************/
+
+bool read_object_and_link(
+  const std::string &file_name,
+  symbol_tablet &symbol_table,
+  goto_functionst &functions,
+  message_handlert &message_handler)
+{
+  link_statet state(symbol_table);
+
+  return read_object_and_link(
+    file_name,
+    symbol_table,
+    functions,
+    state,
+    message_handler);
+}
+
+/*******************************************************************\
+
+   Class: symbol_indext
+
+ Purpose: The symbols of all objects to be linked, by name. A name
+          whose symbols are equal in all objects that have it needs
+          no work when linking them: the destination gets the one
+          of the first object, and keeps it for as long as its type
+          and value are still shared with that one.
+
+\*******************************************************************/
+
+class symbol_indext
+{
+public:
+  explicit symbol_indext(const std::list<goto_modelt> &objects);
+
+  // decides which names have equal symbols, using the given
+  // number of threads
+  void find_identical(unsigned threads);
+
+  std::size_t identical_size() const
+  {
+    return identical.size();
+  }
+
+  // the symbols of the object that the destination has already
+  void get_identical(
+    const symbol_tablet &object,
+    const symbol_tablet &dest,
+    linkingt::id_sett &dest_identical) const;
+
+protected:
+  typedef std::vector<const symbolt *> groupt;
+  typedef std::unordered_map<irep_idt, groupt, irep_id_hash> groupst;
+  groupst groups;
+
+  // the type and value of the first symbol of a name with equal
+  // symbols, as read; the renaming may change the symbol itself
+  struct firstt
+  {
+    typet type;
+    exprt value;
+  };
+
+  typedef std::unordered_map<irep_idt, firstt, irep_id_hash> identicalt;
+  identicalt identical;
+
+  typedef std::vector<const groupst::value_type *> candidatest;
+
+  static bool is_identical(const groupt &group);
+
+  static void check_groups(
+    const candidatest &candidates,
+    std::vector<char> &result,
+    std::size_t first,
+    std::size_t step);
+};
+
+/*******************************************************************\
+
+Function: symbol_indext::symbol_indext
+
+  Inputs: the objects, in the order they are linked
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+symbol_indext::symbol_indext(const std::list<goto_modelt> &objects)
+{
+  for(const auto &object : objects)
+    forall_symbols(it, object.symbol_table.symbols)
+      groups[it->first].push_back(&it->second);
+}
+
+/*******************************************************************\
+
+Function: symbol_indext::is_identical
+
+  Inputs: the symbols of a name
+
+ Outputs: true iff linking them is known to have no effect
+
+ Purpose:
+
+\*******************************************************************/
+
+bool symbol_indext::is_identical(const groupt &group)
+{
+  const symbolt &first=*group.front();
+
+  // file-local symbols are renamed, and duplicate function
+  // definitions give warnings
+  if(first.is_file_local ||
+     (first.type.id()==ID_code && first.value.is_not_nil()))
+    return false;
+
+  for(groupt::const_iterator
+      it=std::next(group.begin());
+      it!=group.end();
+      it++)
+  {
+    const symbolt &symbol=**it;
+
+    if(symbol.is_type!=first.is_type ||
+       symbol.is_macro!=first.is_macro ||
+       symbol.is_extern!=first.is_extern ||
+       symbol.is_weak!=first.is_weak ||
+       symbol.is_file_local!=first.is_file_local ||
+       symbol.type!=first.type ||
+       symbol.value!=first.value)
+      return false;
+  }
+
+  return true;
+}
+
+/*******************************************************************\
+
+Function: symbol_indext::check_groups
+
+  Inputs: the groups, and the share of them to check
+
+ Outputs: whether the groups in the share are identical
+
+ Purpose: Comparing the symbols only reads them, which several
+          threads may do at the same time.
+
+\*******************************************************************/
+
+void symbol_indext::check_groups(
+  const candidatest &candidates,
+  std::vector<char> &result,
+  std::size_t first,
+  std::size_t step)
+{
+  for(std::size_t i=first; i<candidates.size(); i+=step)
+    result[i]=is_identical(candidates[i]->second);
+}
+
+/*******************************************************************\
+
+Function: symbol_indext::find_identical
+
+  Inputs: the number of threads to use
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void symbol_indext::find_identical(unsigned threads)
+{
+  // only the names that several objects have need linking
+  candidatest candidates;
+
+  for(const auto &group : groups)
+    if(group.second.size()>=2)
+      candidates.push_back(&group);
+
+  std::vector<char> result(candidates.size(), false);
+
+  // threads only pay off for many names
+  if(candidates.size()<1000)
+    threads=1;
+
+  if(threads<=1)
+    check_groups(candidates, result, 0, 1);
+  else
+  {
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+
+    for(unsigned i=0; i<threads; i++)
+      workers.push_back(
+        std::thread(
+          check_groups,
+          std::cref(candidates),
+          std::ref(result),
+          i,
+          threads));
+
+    for(auto &w : workers)
+      w.join();
+  }
+
+  for(std::size_t i=0; i<candidates.size(); i++)
+    if(result[i])
+    {
+      const symbolt &first=*candidates[i]->second.front();
+      firstt &f=identical[candidates[i]->first];
+      f.type=first.type;
+      f.value=first.value;
+    }
+
+  groups.clear();
+}
+
+/*******************************************************************\
+
+Function: symbol_indext::get_identical
+
+  Inputs: an object to be linked, and the destination
+
+ Outputs: the symbols of the object that are known to be equal to
+          the ones of the destination
+
+ Purpose: The destination still has the first symbol if its type
+          and value are the very same ireps, which can only be
+          shared as long as none of them is changed.
+
+\*******************************************************************/
+
+void symbol_indext::get_identical(
+  const symbol_tablet &object,
+  const symbol_tablet &dest,
+  linkingt::id_sett &dest_identical) const
+{
+  dest_identical.clear();
+
+  if(identical.empty())
+    return;
+
+  forall_symbols(it, object.symbols)
+  {
+    identicalt::const_iterator i_it=identical.find(it->first);
+
+    if(i_it==identical.end())
+      continue;
+
+    symbol_tablet::symbolst::const_iterator d_it=
+      dest.symbols.find(it->first);
+
+    if(d_it==dest.symbols.end())
+      continue;
+
+    const symbolt &symbol=it->second;
+    const symbolt &dest_symbol=d_it->second;
+
+    // the same nodes; without sharing, these are never the same
+    if(&dest_symbol.type.get_sub()==&i_it->second.type.get_sub() &&
+       &dest_symbol.value.get_sub()==&i_it->second.value.get_sub() &&
+       dest_symbol.is_type==symbol.is_type &&
+       dest_symbol.is_macro==symbol.is_macro &&
+       dest_symbol.is_extern==symbol.is_extern &&
+       dest_symbol.is_weak==symbol.is_weak &&
+       dest_symbol.is_file_local==symbol.is_file_local)
+      dest_identical.insert(it->first);
+  }
+}
+
+/*******************************************************************\
+
+Function: read_objects_and_link
+
+  Inputs: file names
+
+ Outputs: true on error, false otherwise
+
+ Purpose: reads the object files, and links them in the given order
+
+\*******************************************************************/
+
+bool read_objects_and_link(
+  const std::vector<std::string> &file_names,
+  symbol_tablet &symbol_table,
+  goto_functionst &functions,
+  message_handlert &message_handler)
+{
+  messaget message(message_handler);
+
+  // all objects are read first, for the index of their symbols
+  std::list<goto_modelt> objects;
+
+  for(const auto &file_name : file_names)
+  {
+    message.statistics() << "Reading: " << file_name << messaget::eom;
+
+    objects.push_back(goto_modelt());
+
+    if(read_goto_binary(
+        file_name,
+        objects.back(),
+        message_handler))
+      return true;
+  }
+
+  symbol_indext symbol_index(objects);
+  symbol_index.find_identical(std::thread::hardware_concurrency());
+
+  message.statistics() << "Names with equal symbols in all objects: "
+                       << symbol_index.identical_size() << messaget::eom;
+
+  link_statet state(symbol_table);
+  linkingt::id_sett identical_symbols;
+
+  while(!objects.empty())
+  {
+    goto_modelt &object=objects.front();
+
+    symbol_index.get_identical(
+      object.symbol_table,
+      symbol_table,
+      identical_symbols);
+
+    if(link_object(
+         symbol_table,
+         functions,
+         object,
+         &identical_symbols,
+         state,
+         message_handler))
+      return true;
+
+    objects.pop_front();
+  }
 
   return false;
 }
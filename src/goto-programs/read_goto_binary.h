@@ -10,6 +10,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #define CPROVER_GOTO_PROGRAMS_READ_GOTO_BINARY_H
 
 #include <string>
+#include <vector>
 
 class symbol_tablet;
 class goto_functionst;
@@ -40,4 +41,11 @@ bool read_object_and_link(
   goto_modelt &,
   message_handlert &);
 
+// faster than linking the objects one by one
+bool read_objects_and_link(
+  const std::vector<std::string> &file_names,
+  symbol_tablet &,
+  goto_functionst &,
+  message_handlert &);
+
 #endif // CPROVER_GOTO_PROGRAMS_READ_GOTO_BINARY_H
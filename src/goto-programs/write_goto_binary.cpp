@@ -7,6 +7,7 @@ Author: CM Wintersteiger
 \*******************************************************************/
 
 #include <fstream>
+#include <sstream>
 
 #include <util/message.h>
 #include <util/irep_serialization.h>
@@ -16,24 +17,21 @@ Author: CM Wintersteiger
 
 /*******************************************************************\
 
-Function: goto_programt::write_goto_binary_v3
+Function: write_bin_goto_symbols
 
   Inputs:
 
  Outputs:
 
- Purpose: Writes a goto program to disc, using goto binary format ver 2
+ Purpose: Writes the symbol table, as in versions 3 and 4
 
 \*******************************************************************/
 
-bool write_goto_binary_v3(
+static void write_bin_goto_symbols(
   std::ostream &out,
   const symbol_tablet &lsymbol_table,
-  const goto_functionst &functions,
   irep_serializationt &irepconverter)
 {
-  // first write symbol table
-
   write_gb_word(out, lsymbol_table.symbols.size());
 
   forall_symbols(it, lsymbol_table.symbols)
@@ -76,6 +74,74 @@ bool write_goto_binary_v3(
 
     write_gb_word(out, flags);
   }
+}
+
+/*******************************************************************\
+
+Function: write_bin_goto_function
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Writes the body of a function, as in versions 3 and 4
+
+\*******************************************************************/
+
+static void write_bin_goto_function(
+  std::ostream &out,
+  const goto_functionst::goto_functiont &function,
+  irep_serializationt &irepconverter)
+{
+  // Since version 2, goto functions are not converted to ireps,
+  // instead they are saved in a custom binary format
+
+  write_gb_word(out, function.body.instructions.size()); // # instructions
+
+  forall_goto_program_instructions(i_it, function.body)
+  {
+    const goto_programt::instructiont &instruction = *i_it;
+
+    irepconverter.reference_convert(instruction.code, out);
+    irepconverter.write_string_ref(out, instruction.function);
+    irepconverter.reference_convert(instruction.source_location, out);
+    write_gb_word(out, (long)instruction.type);
+    irepconverter.reference_convert(instruction.guard, out);
+    irepconverter.write_string_ref(out, irep_idt()); // former event
+    write_gb_word(out, instruction.target_number);
+
+    write_gb_word(out, instruction.targets.size());
+
+    for(const auto &t_it : instruction.targets)
+      write_gb_word(out, t_it->target_number);
+
+    write_gb_word(out, instruction.labels.size());
+
+    for(const auto &l_it : instruction.labels)
+      irepconverter.write_string_ref(out, l_it);
+  }
+}
+
+/*******************************************************************\
+
+Function: goto_programt::write_goto_binary_v3
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Writes a goto program to disc, using goto binary format ver 3
+
+\*******************************************************************/
+
+bool write_goto_binary_v3(
+  std::ostream &out,
+  const symbol_tablet &lsymbol_table,
+  const goto_functionst &functions,
+  irep_serializationt &irepconverter)
+{
+  // first write symbol table
+  write_bin_goto_symbols(out, lsymbol_table, irepconverter);
 
   // now write functions, but only those with body
 
@@ -90,39 +156,75 @@ bool write_goto_binary_v3(
   {
     if(fct.second.body_available())
     {
-      // Since version 2, goto functions are not converted to ireps,
-      // instead they are saved in a custom binary format
-
       write_gb_string(out, id2string(fct.first)); // name
-      write_gb_word(out, fct.second.body.instructions.size()); // # instructions
+      write_bin_goto_function(out, fct.second, irepconverter);
+    }
+  }
+
+  // irepconverter.output_map(f);
+  // irepconverter.output_string_map(f);
 
-      forall_goto_program_instructions(i_it, fct.second.body)
-      {
-        const goto_programt::instructiont &instruction = *i_it;
+  return false;
+}
+
+/*******************************************************************\
 
-        irepconverter.reference_convert(instruction.code, out);
-        irepconverter.write_string_ref(out, instruction.function);
-        irepconverter.reference_convert(instruction.source_location, out);
-        write_gb_word(out, (long)instruction.type);
-        irepconverter.reference_convert(instruction.guard, out);
-        irepconverter.write_string_ref(out, irep_idt()); // former event
-        write_gb_word(out, instruction.target_number);
+Function: goto_programt::write_goto_binary_v4
 
-        write_gb_word(out, instruction.targets.size());
+  Inputs:
 
-        for(const auto &t_it : instruction.targets)
-          write_gb_word(out, t_it->target_number);
+ Outputs:
 
-        write_gb_word(out, instruction.labels.size());
+ Purpose: Writes a goto program to disc, using goto binary format
+          ver 4. The function bodies are serialized independently
+          of each other and of the symbol table, and are preceded
+          by an index, so that they can be read individually.
 
-        for(const auto &l_it : instruction.labels)
-          irepconverter.write_string_ref(out, l_it);
-      }
+\*******************************************************************/
+
+bool write_goto_binary_v4(
+  std::ostream &out,
+  const symbol_tablet &lsymbol_table,
+  const goto_functionst &functions,
+  irep_serializationt &irepconverter)
+{
+  // first write symbol table
+  write_bin_goto_symbols(out, lsymbol_table, irepconverter);
+
+  // now serialize the functions with body
+  std::vector<std::string> bodies;
+  std::vector<irep_idt> names;
+
+  for(const auto &fct : functions.function_map)
+  {
+    if(fct.second.body_available())
+    {
+      irep_serializationt::ireps_containert ic;
+      irep_serializationt body_converter(ic);
+
+      std::ostringstream body;
+      write_bin_goto_function(body, fct.second, body_converter);
+
+      names.push_back(fct.first);
+      bodies.push_back(body.str());
     }
   }
 
-  // irepconverter.output_map(f);
-  // irepconverter.output_string_map(f);
+  // the index: offsets are relative to its end
+  write_gb_word(out, bodies.size());
+
+  std::size_t offset=0;
+
+  for(std::size_t i=0; i<bodies.size(); i++)
+  {
+    write_gb_string(out, id2string(names[i])); // name
+    write_gb_word(out, offset);
+    write_gb_word(out, bodies[i].size());
+    offset+=bodies[i].size();
+  }
+
+  for(const auto &body : bodies)
+    out.write(body.data(), body.size());
 
   return false;
 }
@@ -165,6 +267,11 @@ bool write_goto_binary(
       out, lsymbol_table, functions,
       irepconverter);
 
+  case 4:
+    return write_goto_binary_v4(
+      out, lsymbol_table, functions,
+      irepconverter);
+
   default:
     throw "unknown goto binary version";
   }
@@ -9,7 +9,7 @@ Author: CM Wintersteiger
 #ifndef CPROVER_GOTO_PROGRAMS_WRITE_GOTO_BINARY_H
 #define CPROVER_GOTO_PROGRAMS_WRITE_GOTO_BINARY_H
 
-#define GOTO_BINARY_VERSION 3
+#define GOTO_BINARY_VERSION 4
 
 #include <iosfwd>
 #include <string>
@@ -224,7 +224,7 @@ void build_goto_trace(
 
     goto_trace_step.thread_nr=SSA_step.source.thread_nr;
     goto_trace_step.pc=SSA_step.source.pc;
-    goto_trace_step.comment=SSA_step.comment;
+    goto_trace_step.comment=id2string(SSA_step.comment);
     if(SSA_step.ssa_lhs.is_not_nil())
       goto_trace_step.lhs_object=
         ssa_exprt(SSA_step.ssa_lhs.get_original_expr());
@@ -232,9 +232,9 @@ void build_goto_trace(
       goto_trace_step.lhs_object.make_nil();
     goto_trace_step.type=SSA_step.type;
     goto_trace_step.hidden=SSA_step.hidden;
-    goto_trace_step.format_string=SSA_step.format_string;
-    goto_trace_step.io_id=SSA_step.io_id;
-    goto_trace_step.formatted=SSA_step.formatted;
+    goto_trace_step.format_string=SSA_step.io.read().format_string;
+    goto_trace_step.io_id=SSA_step.io.read().io_id;
+    goto_trace_step.formatted=SSA_step.io.read().formatted;
     goto_trace_step.identifier=SSA_step.identifier;
 
     goto_trace_step.assignment_type=
@@ -258,7 +258,7 @@ void build_goto_trace(
       simplify(goto_trace_step.full_lhs_value, ns);
     }
 
-    for(const auto &j : SSA_step.converted_io_args)
+    for(const auto &j : SSA_step.io.read().converted_io_args)
     {
       if(j.is_constant() ||
          j.id()==ID_string_constant)
@@ -6,7 +6,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 \*******************************************************************/
 
-#include <util/simplify_expr.h>
+#include <util/simplify_expr_class.h>
 
 #include "goto_symex.h"
 
@@ -28,7 +28,11 @@ Function: goto_symext::do_simplify
 void goto_symext::do_simplify(exprt &expr)
 {
   if(options.get_bool_option("simplify"))
-    simplify(expr, ns);
+  {
+    simplify_exprt simplify_expr(ns);
+    simplify_expr.set_cache(simplify_cache);
+    simplify_expr.simplify(expr);
+  }
 }
 
 /*******************************************************************\
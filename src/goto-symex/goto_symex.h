@@ -14,10 +14,12 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <util/options.h>
 #include <util/byte_operators.h>
+#include <util/simplify_expr_cache.h>
 
 #include <goto-programs/goto_functions.h>
 
 #include "goto_symex_state.h"
+#include "guard_manager.h"
 
 class typet;
 class code_typet;
@@ -91,6 +93,9 @@ public:
   // statistics
   unsigned total_vccs, remaining_vccs;
 
+  // results of do_simplify, with hit/miss statistics
+  simplify_expr_cachet simplify_cache;
+
   bool constant_propagation;
 
   optionst options;
@@ -151,6 +156,9 @@ protected:
 
   irep_idt guard_identifier;
 
+  // used with the option bdd-guards
+  guard_managert guard_manager;
+
   // symex
 
   virtual void symex_goto(statet &state);
@@ -10,9 +10,11 @@ Author: Daniel Kroening, kroening@kroening.com
 #define CPROVER_GOTO_SYMEX_GOTO_SYMEX_STATE_H
 
 #include <cassert>
+#include <unordered_map>
 #include <unordered_set>
 
 #include <util/guard.h>
+#include <util/sharing_map.h>
 #include <util/std_expr.h>
 #include <util/ssa_expr.h>
 
@@ -38,19 +40,24 @@ public:
 
   void initialize(const goto_functionst &goto_functions);
 
-  // we have a two-level renaming
+  // we have a two-level renaming; the maps below are hashed by
+  // the number of the identifier, and are not ordered. The states
+  // that are saved at branches share the names and values that
+  // neither side changes.
 
-  typedef std::map<irep_idt, irep_idt> original_identifierst;
+  typedef std::unordered_map<irep_idt, irep_idt, irep_id_hash>
+    original_identifierst;
 
   // we remember all L1 renamings
-  typedef std::set<irep_idt> l1_historyt;
+  typedef std::unordered_set<irep_idt, irep_id_hash> l1_historyt;
   l1_historyt l1_history;
 
   struct renaming_levelt
   {
     virtual ~renaming_levelt() { }
 
-    typedef std::map<irep_idt, std::pair<ssa_exprt, unsigned> > current_namest;
+    typedef sharing_mapt<
+      irep_idt, std::pair<ssa_exprt, unsigned>, irep_id_hash> current_namest;
     current_namest current_names;
 
     unsigned current_count(const irep_idt &identifier) const
@@ -97,22 +104,15 @@ public:
 
     void restore_from(const current_namest &other)
     {
-      current_namest::iterator it=current_names.begin();
       for(current_namest::const_iterator
           ito=other.begin();
           ito!=other.end();
           ++ito)
       {
-        while(it!=current_names.end() && it->first<ito->first)
-          ++it;
-        if(it==current_names.end() || ito->first<it->first)
-          current_names.insert(it, *ito);
-        else if(it!=current_names.end())
-        {
-          assert(it->first==ito->first);
-          it->second=ito->second;
-          ++it;
-        }
+        std::pair<current_namest::mapped_type &, bool> r=
+          current_names.insert(*ito);
+        if(!r.second)
+          r.first=ito->second;
       }
     }
 
@@ -132,7 +132,7 @@ public:
   class propagationt
   {
   public:
-    typedef std::map<irep_idt, exprt> valuest;
+    typedef sharing_mapt<irep_idt, exprt, irep_id_hash> valuest;
     valuest values;
     void operator()(exprt &expr);
 
@@ -242,7 +242,7 @@ public:
 
     renaming_levelt::current_namest old_level1;
 
-    typedef std::set<irep_idt> local_objectst;
+    typedef std::unordered_set<irep_idt, irep_id_hash> local_objectst;
     local_objectst local_objects;
 
     framet():
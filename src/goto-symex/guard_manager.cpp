@@ -0,0 +1,439 @@
+/*******************************************************************\
+
+Module: Canonical Guards using BDDs
+
+Author:
+
+\*******************************************************************/
+
+#include <algorithm>
+#include <string>
+
+#include <util/std_expr.h>
+
+#include "guard_manager.h"
+
+/*******************************************************************\
+
+Function: guard_managert::guard_managert
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+guard_managert::guard_managert():
+  reserved_variables(0),
+  needs_rebuild(false),
+  cache_limit(min_cache_limit)
+{
+  rebuild();
+}
+
+/*******************************************************************\
+
+Function: guard_managert::from_expr
+
+  Inputs: a Boolean expression
+
+ Outputs: its BDD
+
+ Purpose:
+
+\*******************************************************************/
+
+mini_bddt guard_managert::from_expr(const exprt &expr)
+{
+  bdd_mapt::const_iterator entry=bdd_map.find(expr);
+
+  if(entry!=bdd_map.end())
+    return entry->second;
+
+  mini_bddt result=from_expr_rec(expr);
+  bdd_map.insert(std::make_pair(expr, result));
+
+  return result;
+}
+
+/*******************************************************************\
+
+Function: guard_managert::from_expr_rec
+
+  Inputs: a Boolean expression
+
+ Outputs: its BDD
+
+ Purpose: Anything that isn't a Boolean connective is a condition,
+          and gets a BDD variable of its own.
+
+\*******************************************************************/
+
+mini_bddt guard_managert::from_expr_rec(const exprt &expr)
+{
+  assert(expr.type().id()==ID_bool);
+
+  if(expr.is_true())
+    return bdd_mgr->True();
+  else if(expr.is_false())
+    return bdd_mgr->False();
+  else if(expr.id()==ID_not && expr.operands().size()==1)
+    return !from_expr(expr.op0());
+  else if(expr.id()==ID_and && expr.has_operands())
+  {
+    mini_bddt result=bdd_mgr->True();
+
+    forall_operands(it, expr)
+    {
+      result=result&from_expr(*it);
+
+      if(result.is_false())
+        break;
+    }
+
+    return result;
+  }
+  else if(expr.id()==ID_or && expr.has_operands())
+  {
+    mini_bddt result=bdd_mgr->False();
+
+    forall_operands(it, expr)
+    {
+      result=result|from_expr(*it);
+
+      if(result.is_true())
+        break;
+    }
+
+    return result;
+  }
+  else if(expr.id()==ID_implies && expr.operands().size()==2)
+    return (!from_expr(expr.op0()))|from_expr(expr.op1());
+  else if(expr.id()==ID_if)
+  {
+    const if_exprt &if_expr=to_if_expr(expr);
+
+    mini_bddt cond=from_expr(if_expr.cond());
+    mini_bddt t_case=from_expr(if_expr.true_case());
+    mini_bddt f_case=from_expr(if_expr.false_case());
+
+    return (cond&t_case)|((!cond)&f_case);
+  }
+
+  return condition(expr);
+}
+
+/*******************************************************************\
+
+Function: guard_managert::condition
+
+  Inputs: a condition
+
+ Outputs: the BDD of its variable
+
+ Purpose:
+
+\*******************************************************************/
+
+mini_bddt guard_managert::condition(const exprt &expr)
+{
+  condition_mapt::const_iterator entry=condition_map.find(expr);
+
+  unsigned var;
+
+  if(entry!=condition_map.end())
+    var=entry->second;
+  else
+  {
+    conditions.push_back(expr);
+
+    if(conditions.size()<=reserved_variables)
+      var=reserved_variables+1-conditions.size();
+    else
+    {
+      // none left, add one below all others
+      var=bdd_mgr->Var("").var();
+      variable_conditions.resize(var+1);
+      needs_rebuild=true;
+    }
+
+    condition_map[expr]=var;
+    variable_conditions[var]=expr;
+  }
+
+  return bdd_mgr->mk(var, bdd_mgr->False(), bdd_mgr->True());
+}
+
+/*******************************************************************\
+
+Function: guard_managert::as_expr
+
+  Inputs: a BDD
+
+ Outputs: an expression for it
+
+ Purpose: The subexpressions for shared nodes are shared, too.
+
+\*******************************************************************/
+
+const exprt &guard_managert::as_expr(const mini_bddt &bdd)
+{
+  expr_mapt::const_iterator entry=expr_map.find(bdd.node_number());
+
+  if(entry!=expr_map.end())
+    return entry->second.expr;
+
+  exprt result;
+
+  if(bdd.is_true())
+    result=true_exprt();
+  else if(bdd.is_false())
+    result=false_exprt();
+  else
+  {
+    assert(bdd.var()<variable_conditions.size());
+    const exprt &condition=variable_conditions[bdd.var()];
+
+    const mini_bddt &low=bdd.low();
+    const mini_bddt &high=bdd.high();
+
+    if(low.is_false())
+    {
+      if(high.is_true())
+        result=condition;
+      else
+        result=and_exprt(condition, as_expr(high));
+    }
+    else if(high.is_false())
+    {
+      if(low.is_true())
+        result=not_exprt(condition);
+      else
+        result=and_exprt(not_exprt(condition), as_expr(low));
+    }
+    else if(low.is_true())
+      result=or_exprt(not_exprt(condition), as_expr(high));
+    else if(high.is_true())
+      result=or_exprt(condition, as_expr(low));
+    else
+      result=if_exprt(condition, as_expr(high), as_expr(low));
+  }
+
+  // guards built from this expression will find its BDD
+  bdd_map.insert(std::make_pair(result, bdd));
+
+  expr_entryt &new_entry=expr_map[bdd.node_number()];
+  new_entry.bdd=bdd;
+  new_entry.expr.swap(result);
+
+  return new_entry.expr;
+}
+
+/*******************************************************************\
+
+Function: guard_managert::restrict_rec
+
+  Inputs: a function f, and the care set
+
+ Outputs: a function that agrees with f on the care set
+
+ Purpose: the 'restrict' operator of Coudert and Madre, which
+          tends to make f smaller by choosing its values outside
+          of the care set
+
+\*******************************************************************/
+
+mini_bddt guard_managert::restrict_rec(
+  const mini_bddt &f,
+  const mini_bddt &care,
+  restrict_cachet &cache)
+{
+  if(care.is_false())
+    return bdd_mgr->False();
+
+  if(care.is_true() || f.is_constant())
+    return f;
+
+  std::pair<unsigned, unsigned> key(f.node_number(), care.node_number());
+
+  restrict_cachet::const_iterator entry=cache.find(key);
+  if(entry!=cache.end())
+    return entry->second;
+
+  // the constants have the highest variable number
+  const unsigned var=std::min(f.var(), care.var());
+
+  mini_bddt result;
+
+  if(care.var()==var && care.low().is_false())
+    result=restrict_rec(f.var()==var?f.high():f, care.high(), cache);
+  else if(care.var()==var && care.high().is_false())
+    result=restrict_rec(f.var()==var?f.low():f, care.low(), cache);
+  else if(f.var()!=var)
+    result=restrict_rec(f, care.low()|care.high(), cache);
+  else
+  {
+    const mini_bddt &care_low=care.var()==var?care.low():care;
+    const mini_bddt &care_high=care.var()==var?care.high():care;
+
+    result=bdd_mgr->mk(
+      var,
+      restrict_rec(f.low(), care_low, cache),
+      restrict_rec(f.high(), care_high, cache));
+  }
+
+  cache[key]=result;
+
+  return result;
+}
+
+/*******************************************************************\
+
+Function: guard_managert::clear_caches
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void guard_managert::clear_caches()
+{
+  expr_map.clear();
+  bdd_map.clear();
+}
+
+/*******************************************************************\
+
+Function: guard_managert::rebuild
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Start over with a new BDD manager that has room for twice
+          as many conditions as there are, all of which get a new
+          variable. The guards are expressions, and will simply be
+          converted again.
+
+\*******************************************************************/
+
+void guard_managert::rebuild()
+{
+  clear_caches();
+
+  bdd_mgr=std::unique_ptr<mini_bdd_mgrt>(new mini_bdd_mgrt);
+
+  reserved_variables=std::max(std::size_t(1024), 2*conditions.size());
+
+  for(std::size_t i=0; i<reserved_variables; i++)
+    bdd_mgr->Var("");
+
+  variable_conditions.clear();
+  variable_conditions.resize(reserved_variables+1);
+  condition_map.clear();
+
+  for(std::size_t i=0; i<conditions.size(); i++)
+  {
+    unsigned var=reserved_variables-i;
+    condition_map[conditions[i]]=var;
+    variable_conditions[var]=conditions[i];
+  }
+
+  needs_rebuild=false;
+}
+
+/*******************************************************************\
+
+Function: guard_managert::collect_garbage
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: drop the caches once they have grown large, so that the
+          BDD nodes that are no longer needed are freed, and rebuild
+          if there are conditions that didn't get a reserved variable
+
+\*******************************************************************/
+
+void guard_managert::collect_garbage()
+{
+  if(needs_rebuild)
+    rebuild();
+  else if(expr_map.size()+bdd_map.size()>=cache_limit)
+  {
+    clear_caches();
+
+    cache_limit=2*bdd_mgr->number_of_nodes();
+    if(cache_limit<min_cache_limit)
+      cache_limit=min_cache_limit;
+  }
+}
+
+/*******************************************************************\
+
+Function: guard_managert::canonicalize
+
+  Inputs: a guard
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void guard_managert::canonicalize(guardt &guard)
+{
+  collect_garbage();
+
+  guard=as_expr(from_expr(guard));
+}
+
+/*******************************************************************\
+
+Function: guard_managert::disjoin
+
+  Inputs: two guards
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void guard_managert::disjoin(guardt &guard, const guardt &other)
+{
+  collect_garbage();
+
+  guard=as_expr(from_expr(guard)|from_expr(other));
+}
+
+/*******************************************************************\
+
+Function: guard_managert::difference
+
+  Inputs: two guards
+
+ Outputs: a condition that distinguishes them
+
+ Purpose: 'guard' restricted to the states in which either guard
+          holds, which leaves out what both have in common
+
+\*******************************************************************/
+
+exprt guard_managert::difference(const guardt &guard, const guardt &other)
+{
+  collect_garbage();
+
+  mini_bddt f=from_expr(guard);
+  mini_bddt care=f|from_expr(other);
+
+  restrict_cachet cache;
+
+  return as_expr(restrict_rec(f, care, cache));
+}
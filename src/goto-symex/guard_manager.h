@@ -0,0 +1,108 @@
+/*******************************************************************\
+
+Module: Canonical Guards using BDDs
+
+Author:
+
+\*******************************************************************/
+
+#ifndef CPROVER_GOTO_SYMEX_GUARD_MANAGER_H
+#define CPROVER_GOTO_SYMEX_GUARD_MANAGER_H
+
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <util/guard.h>
+
+#include <solvers/miniBDD/miniBDD.h>
+
+/*! \brief Keeps guards in a canonical form, by representing them as
+           BDDs over the conditions of the branches
+
+  Equivalent guards become the same expression, and a guard that
+  can't be satisfied becomes false. Both directions of the
+  conversion are cached, so that extending a guard that was
+  produced by the manager only costs the conversion of the new part.
+
+  The conditions are ordered such that the newest one is at the
+  root of the BDDs. Adding a condition to a guard, or merging the
+  two guards of a branch, thus only changes the root.
+*/
+class guard_managert
+{
+public:
+  guard_managert();
+
+  // replaces the guard by its canonical form
+  void canonicalize(guardt &guard);
+
+  // guard|=other, in canonical form
+  void disjoin(guardt &guard, const guardt &other);
+
+  // Returns a condition that holds when 'guard' holds, and that
+  // doesn't hold when 'other' holds, as needed for choosing
+  // between the values of two branches that are merged.
+  exprt difference(const guardt &guard, const guardt &other);
+
+  std::size_t number_of_nodes()
+  {
+    return bdd_mgr->number_of_nodes();
+  }
+
+protected:
+  // declared first, so that it's destroyed after the BDDs below
+  std::unique_ptr<mini_bdd_mgrt> bdd_mgr;
+
+  // the conditions, in the order they were first seen
+  std::vector<exprt> conditions;
+
+  // The BDD variables are reserved in advance, and given to the
+  // conditions from the highest to the lowest, i.e., from the
+  // leaves to the root. Variables for conditions seen when there
+  // are none left are added at the leaves, until the next rebuild.
+  std::size_t reserved_variables;
+  bool needs_rebuild;
+
+  typedef std::unordered_map<exprt, unsigned, irep_hash> condition_mapt;
+  condition_mapt condition_map;
+  std::vector<exprt> variable_conditions;
+
+  // the BDDs of the guards seen or produced, and of their operands
+  typedef std::unordered_map<exprt, mini_bddt, irep_hash> bdd_mapt;
+  bdd_mapt bdd_map;
+
+  // the expressions for the BDD nodes, by node number; the entry
+  // keeps the node from being freed, and its number from being reused
+  struct expr_entryt
+  {
+    mini_bddt bdd;
+    exprt expr;
+  };
+
+  typedef std::unordered_map<unsigned, expr_entryt> expr_mapt;
+  expr_mapt expr_map;
+
+  mini_bddt from_expr(const exprt &expr);
+  mini_bddt from_expr_rec(const exprt &expr);
+  mini_bddt condition(const exprt &expr);
+  const exprt &as_expr(const mini_bddt &bdd);
+
+  // The caches keep all BDDs they mention alive; they are
+  // dropped when they have grown too large.
+  static const std::size_t min_cache_limit=100000;
+  std::size_t cache_limit;
+
+  void clear_caches();
+  void rebuild();
+  void collect_garbage();
+
+  typedef std::map<std::pair<unsigned, unsigned>, mini_bddt> restrict_cachet;
+  mini_bddt restrict_rec(
+    const mini_bddt &f,
+    const mini_bddt &care,
+    restrict_cachet &cache);
+};
+
+#endif // CPROVER_GOTO_SYMEX_GUARD_MANAGER_H
@@ -299,10 +299,10 @@ void symex_slice_by_tracet::compute_ts_back(
       i++)
   {
     if(i->is_output() &&
-       !i->io_args.empty() &&
-       i->io_args.front().id()=="trace_event")
+       !i->io.read().io_args.empty() &&
+       i->io.read().io_args.front().id()=="trace_event")
     {
-      irep_idt event=i->io_args.front().get("event");
+      irep_idt event=i->io.read().io_args.front().get("event");
 
       if(!alphabet.empty())
       {
@@ -355,7 +355,8 @@ void symex_slice_by_tracet::compute_ts_back(
           if(!sigma_vals[j].empty())
           {
             std::list<exprt> eq_conds;
-            std::list<exprt>::iterator pvi=i->io_args.begin();
+            std::list<exprt>::const_iterator pvi=
+              i->io.read().io_args.begin();
             for(std::vector<irep_idt>::iterator k=sigma_vals[j].begin();
                  k!=sigma_vals[j].end(); k++)
             {
@@ -9,6 +9,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <iostream>
 #include <sstream>
 #include <cassert>
+#include <vector>
 
 #include <util/cprover_prefix.h>
 #include <util/prefix.h>
@@ -400,25 +401,29 @@ void goto_symext::pop_frame(statet &state)
 
     // clear function-locals from L2 renaming
     assert(state.dirty);
-    for(goto_symex_statet::renaming_levelt::current_namest::iterator
+    std::vector<irep_idt> locals;
+
+    for(goto_symex_statet::renaming_levelt::current_namest::const_iterator
         c_it=state.level2.current_names.begin();
         c_it!=state.level2.current_names.end();
-       ) // no ++c_it
+        ++c_it)
     {
       const irep_idt l1_o_id=c_it->second.first.get_l1_object_identifier();
       // could use iteration over local_objects as l1_o_id is prefix
       if(frame.local_objects.find(l1_o_id)==frame.local_objects.end() ||
          (state.threads.size()>1 &&
           (*state.dirty)(c_it->second.first.get_object_name())))
-      {
-        ++c_it;
         continue;
-      }
-      goto_symex_statet::renaming_levelt::current_namest::iterator
-        cur=c_it;
-      ++c_it;
-      state.level2.current_names.erase(cur);
+
+      locals.push_back(c_it->first);
     }
+
+    // the names can't be erased while iterating over them
+    for(std::vector<irep_idt>::const_iterator
+        l_it=locals.begin();
+        l_it!=locals.end();
+        ++l_it)
+      state.level2.current_names.erase(*l_it);
   }
 
   state.pop_frame();
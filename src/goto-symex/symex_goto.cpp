@@ -8,6 +8,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <cassert>
 #include <algorithm>
+#include <vector>
 
 #include <util/std_expr.h>
 
@@ -171,6 +172,13 @@ void goto_symext::symex_goto(statet &state)
       guard_expr.make_not();
       new_state.guard.add(guard_expr);
     }
+
+    // makes the guard of an infeasible branch false
+    if(options.get_bool_option("bdd-guards"))
+    {
+      guard_manager.canonicalize(state.guard);
+      guard_manager.canonicalize(new_state.guard);
+    }
   }
 }
 
@@ -246,7 +254,10 @@ void goto_symext::merge_gotos(statet &state)
     merge_value_sets(goto_state, state);
 
     // adjust guard
-    state.guard|=goto_state.guard;
+    if(options.get_bool_option("bdd-guards"))
+      guard_manager.disjoin(state.guard, goto_state.guard);
+    else
+      state.guard|=goto_state.guard;
 
     // adjust depth
     state.depth=std::min(state.depth, goto_state.depth);
@@ -297,13 +308,51 @@ void goto_symext::phi_function(
   const statet::goto_statet &goto_state,
   statet &dest_state)
 {
-  // go over all variables to see what changed
-  std::unordered_set<ssa_exprt, irep_hash> variables;
+  // go over all variables to see what changed; the names that the
+  // two states share haven't
+  typedef goto_symex_statet::renaming_levelt::current_namest
+    current_namest;
+  current_namest::delta_viewt delta_view;
+
+  goto_state.level2_current_names.get_delta_view(
+    dest_state.level2.current_names, delta_view);
+
+  // the assignments below change the names of dest_state
+  std::vector<ssa_exprt> variables;
+  variables.reserve(delta_view.size());
+
+  for(current_namest::delta_viewt::const_iterator
+      it=delta_view.begin();
+      it!=delta_view.end();
+      it++)
+  {
+    if(it->value!=NULL)
+      variables.push_back(it->value->first);
+    else
+      variables.push_back(it->other_value->first);
+  }
+
+  // the condition for choosing the value of goto_state,
+  // which is the same for all variables
+  exprt diff_guard;
+
+  if(!dest_state.guard.is_false() &&
+     !goto_state.guard.is_false())
+  {
+    if(options.get_bool_option("bdd-guards"))
+      diff_guard=guard_manager.difference(goto_state.guard, dest_state.guard);
+    else
+    {
+      guardt tmp_guard(goto_state.guard);
+
+      // this gets the diff between the guards
+      tmp_guard-=dest_state.guard;
 
-  goto_state.level2_get_variables(variables);
-  dest_state.level2.get_variables(variables);
+      diff_guard=tmp_guard.as_expr();
+    }
+  }
 
-  for(std::unordered_set<ssa_exprt, irep_hash>::const_iterator
+  for(std::vector<ssa_exprt>::const_iterator
       it=variables.begin();
       it!=variables.end();
       it++)
@@ -370,12 +419,7 @@ void goto_symext::phi_function(
       rhs=dest_state_rhs;
     else
     {
-      guardt tmp_guard(goto_state.guard);
-
-      // this gets the diff between the guards
-      tmp_guard-=dest_state.guard;
-
-      rhs=if_exprt(tmp_guard.as_expr(), goto_state_rhs, dest_state_rhs);
+      rhs=if_exprt(diff_guard, goto_state_rhs, dest_state_rhs);
       do_simplify(rhs);
     }
 
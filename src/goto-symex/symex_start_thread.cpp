@@ -6,6 +6,8 @@ Author: Daniel Kroening, kroening@kroening.com
 
 \*******************************************************************/
 
+#include <map>
+
 #include <linking/zero_initializer.h>
 
 #include "goto_symex.h"
@@ -60,6 +62,11 @@ void goto_symext::symex_start_thread(statet &state)
   // create a copy of the local variables for the new thread
   statet::framet &frame=state.top();
 
+  // The assignments below add to the L2 names, and these aren't
+  // ordered; collect the locals first, in a fixed order.
+  typedef std::map<irep_idt, ssa_exprt> localst;
+  localst locals;
+
   for(goto_symex_statet::renaming_levelt::current_namest::const_iterator
       c_it=state.level2.current_names.begin();
       c_it!=state.level2.current_names.end();
@@ -70,8 +77,16 @@ void goto_symext::symex_start_thread(statet &state)
     if(frame.local_objects.find(l1_o_id)==frame.local_objects.end())
       continue;
 
+    locals.insert(std::make_pair(c_it->first, c_it->second.first));
+  }
+
+  for(localst::const_iterator
+      l_it=locals.begin();
+      l_it!=locals.end();
+      ++l_it)
+  {
     // get original name
-    ssa_exprt lhs(c_it->second.first.get_original_expr());
+    ssa_exprt lhs(l_it->second.get_original_expr());
 
     // get L0 name for current thread
     lhs.set_level_0(t);
@@ -88,7 +103,7 @@ void goto_symext::symex_start_thread(statet &state)
     new_thread.call_stack.back().local_objects.insert(l1_name);
 
     // make copy
-    ssa_exprt rhs=c_it->second.first;
+    ssa_exprt rhs=l_it->second;
 
     guardt guard;
     const bool record_events=state.record_events;
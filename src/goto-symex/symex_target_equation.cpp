@@ -18,6 +18,9 @@ Author: Daniel Kroening, kroening@kroening.com
 #include "goto_symex_state.h"
 #include "symex_target_equation.h"
 
+const symex_target_equationt::SSA_stept::io_datat
+  symex_target_equationt::SSA_stept::io_datat::blank;
+
 /*******************************************************************\
 
 Function: symex_target_equationt::symex_target_equationt
@@ -31,7 +34,12 @@ Function: symex_target_equationt::symex_target_equationt
 \*******************************************************************/
 
 symex_target_equationt::symex_target_equationt(
-  const namespacet &_ns):ns(_ns)
+  const namespacet &_ns):
+  ns(_ns),
+  stream_conv(NULL),
+  streamed_steps(0),
+  stream_io_count(0),
+  stream_assumption(const_literal(true))
 {
 }
 
@@ -79,6 +87,7 @@ void symex_target_equationt::shared_read(
   SSA_step.source=source;
 
   merge_ireps(SSA_step);
+  stream_step(SSA_step);
 }
 
 /*******************************************************************\
@@ -109,6 +118,7 @@ void symex_target_equationt::shared_write(
   SSA_step.source=source;
 
   merge_ireps(SSA_step);
+  stream_step(SSA_step);
 }
 
 /*******************************************************************\
@@ -134,6 +144,7 @@ void symex_target_equationt::spawn(
   SSA_step.source=source;
 
   merge_ireps(SSA_step);
+  stream_step(SSA_step);
 }
 
 /*******************************************************************\
@@ -159,6 +170,7 @@ void symex_target_equationt::memory_barrier(
   SSA_step.source=source;
 
   merge_ireps(SSA_step);
+  stream_step(SSA_step);
 }
 
 /*******************************************************************\
@@ -186,6 +198,7 @@ void symex_target_equationt::atomic_begin(
   SSA_step.source=source;
 
   merge_ireps(SSA_step);
+  stream_step(SSA_step);
 }
 
 /*******************************************************************\
@@ -213,6 +226,7 @@ void symex_target_equationt::atomic_end(
   SSA_step.source=source;
 
   merge_ireps(SSA_step);
+  stream_step(SSA_step);
 }
 
 /*******************************************************************\
@@ -255,6 +269,7 @@ void symex_target_equationt::assignment(
   SSA_step.source=source;
 
   merge_ireps(SSA_step);
+  stream_step(SSA_step);
 }
 
 /*******************************************************************\
@@ -293,6 +308,7 @@ void symex_target_equationt::decl(
   SSA_step.cond_expr=equal_exprt(SSA_step.ssa_lhs, SSA_step.ssa_lhs);
 
   merge_ireps(SSA_step);
+  stream_step(SSA_step);
 }
 
 /*******************************************************************\
@@ -339,6 +355,7 @@ void symex_target_equationt::location(
   SSA_step.source=source;
 
   merge_ireps(SSA_step);
+  stream_step(SSA_step);
 }
 
 /*******************************************************************\
@@ -367,6 +384,7 @@ void symex_target_equationt::function_call(
   SSA_step.identifier=identifier;
 
   merge_ireps(SSA_step);
+  stream_step(SSA_step);
 }
 
 /*******************************************************************\
@@ -395,6 +413,7 @@ void symex_target_equationt::function_return(
   SSA_step.identifier=identifier;
 
   merge_ireps(SSA_step);
+  stream_step(SSA_step);
 }
 
 /*******************************************************************\
@@ -421,10 +440,12 @@ void symex_target_equationt::output(
   SSA_step.guard=guard;
   SSA_step.type=goto_trace_stept::OUTPUT;
   SSA_step.source=source;
-  SSA_step.io_args=args;
-  SSA_step.io_id=output_id;
+  SSA_stept::io_datat &io=SSA_step.io.write();
+  io.io_args=args;
+  io.io_id=output_id;
 
   merge_ireps(SSA_step);
+  stream_step(SSA_step);
 }
 
 /*******************************************************************\
@@ -452,12 +473,14 @@ void symex_target_equationt::output_fmt(
   SSA_step.guard=guard;
   SSA_step.type=goto_trace_stept::OUTPUT;
   SSA_step.source=source;
-  SSA_step.io_args=args;
-  SSA_step.io_id=output_id;
-  SSA_step.formatted=true;
-  SSA_step.format_string=fmt;
+  SSA_stept::io_datat &io=SSA_step.io.write();
+  io.io_args=args;
+  io.io_id=output_id;
+  io.formatted=true;
+  io.format_string=fmt;
 
   merge_ireps(SSA_step);
+  stream_step(SSA_step);
 }
 
 /*******************************************************************\
@@ -484,10 +507,12 @@ void symex_target_equationt::input(
   SSA_step.guard=guard;
   SSA_step.type=goto_trace_stept::INPUT;
   SSA_step.source=source;
-  SSA_step.io_args=args;
-  SSA_step.io_id=input_id;
+  SSA_stept::io_datat &io=SSA_step.io.write();
+  io.io_args=args;
+  io.io_id=input_id;
 
   merge_ireps(SSA_step);
+  stream_step(SSA_step);
 }
 
 /*******************************************************************\
@@ -516,6 +541,7 @@ void symex_target_equationt::assumption(
   SSA_step.source=source;
 
   merge_ireps(SSA_step);
+  stream_step(SSA_step);
 }
 
 /*******************************************************************\
@@ -546,6 +572,7 @@ void symex_target_equationt::assertion(
   SSA_step.comment=msg;
 
   merge_ireps(SSA_step);
+  stream_step(SSA_step);
 }
 
 /*******************************************************************\
@@ -574,6 +601,7 @@ void symex_target_equationt::goto_instruction(
   SSA_step.source=source;
 
   merge_ireps(SSA_step);
+  stream_step(SSA_step);
 }
 
 /*******************************************************************\
@@ -604,6 +632,7 @@ void symex_target_equationt::constraint(
   SSA_step.comment=msg;
 
   merge_ireps(SSA_step);
+  stream_step(SSA_step);
 }
 
 /*******************************************************************\
@@ -621,6 +650,14 @@ Function: symex_target_equationt::convert
 void symex_target_equationt::convert(
   prop_convt &prop_conv)
 {
+  if(stream_conv!=NULL)
+  {
+    // all other steps have been converted already
+    assert(&prop_conv==stream_conv);
+    convert_stream_assertions(prop_conv);
+    return;
+  }
+
   convert_guards(prop_conv);
   convert_assignments(prop_conv);
   convert_decls(prop_conv);
@@ -879,13 +916,15 @@ void symex_target_equationt::convert_io(
   unsigned io_count=0;
 
   for(auto &step : SSA_steps)
-    if(!step.ignore)
+    if(!step.ignore && !step.io.read().io_args.empty())
     {
-      for(const auto &arg : step.io_args)
+      SSA_stept::io_datat &io=step.io.write();
+
+      for(const auto &arg : io.io_args)
       {
         if(arg.is_constant() ||
            arg.id()==ID_string_constant)
-          step.converted_io_args.push_back(arg);
+          io.converted_io_args.push_back(arg);
         else
         {
           symbol_exprt symbol;
@@ -896,13 +935,241 @@ void symex_target_equationt::convert_io(
           merge_irep(eq);
 
           dec_proc.set_to(eq, true);
-          step.converted_io_args.push_back(symbol);
+          io.converted_io_args.push_back(symbol);
         }
       }
     }
 }
 
 
+/*******************************************************************\
+
+Function: symex_target_equationt::convert_incremental
+
+  Inputs: converter, number of steps converted before, number of
+          steps whose constraints are permanent, activation literal
+          for the constraints of the remaining steps
+
+ Outputs:
+
+ Purpose: converts all steps but the assertions, for solving the
+          equations of increasing unwinding bounds with the same
+          solver; the steps up to 'permanent' must be the same in
+          all later equations
+
+\*******************************************************************/
+
+void symex_target_equationt::convert_incremental(
+  prop_convt &prop_conv,
+  std::size_t converted,
+  std::size_t permanent,
+  literalt activation)
+{
+  assert(converted<=permanent);
+
+  std::size_t step_nr=0;
+  unsigned io_count=0;
+
+  for(auto &step : SSA_steps)
+  {
+    // these are cached for the steps converted before
+    if(step.ignore)
+      step.guard_literal=const_literal(false);
+    else
+      step.guard_literal=prop_conv.convert(step.guard);
+
+    if(step.is_assume() || step.is_goto())
+    {
+      if(step.ignore)
+        step.cond_literal=const_literal(true);
+      else
+        step.cond_literal=prop_conv.convert(step.cond_expr);
+    }
+
+    const bool is_new=step_nr>=converted && !step.ignore;
+    const bool is_permanent=step_nr<permanent;
+    step_nr++;
+
+    if(is_new)
+    {
+      if(step.is_decl())
+        prop_conv.convert(step.cond_expr);
+      else if(step.is_assignment() || step.is_constraint())
+      {
+        if(is_permanent)
+          prop_conv.set_to_true(step.cond_expr);
+        else
+          prop_conv.set_to_true(
+            implies_exprt(literal_exprt(activation), step.cond_expr));
+      }
+    }
+
+    if(step.ignore || step.io.read().io_args.empty())
+      continue;
+
+    SSA_stept::io_datat &io=step.io.write();
+
+    for(const auto &arg : io.io_args)
+    {
+      if(arg.is_constant() ||
+         arg.id()==ID_string_constant)
+        io.converted_io_args.push_back(arg);
+      else
+      {
+        symbol_exprt symbol;
+        symbol.type()=arg.type();
+        symbol.set_identifier("symex::io::"+std::to_string(io_count++));
+
+        if(is_new)
+        {
+          equal_exprt eq(arg, symbol);
+          merge_irep(eq);
+
+          if(is_permanent)
+            prop_conv.set_to_true(eq);
+          else
+            prop_conv.set_to_true(
+              implies_exprt(literal_exprt(activation), eq));
+        }
+
+        io.converted_io_args.push_back(symbol);
+      }
+    }
+  }
+}
+
+/*******************************************************************\
+
+Function: symex_target_equationt::set_stream_converter
+
+  Inputs: converter
+
+ Outputs:
+
+ Purpose: start streaming conversion, before any step is recorded
+
+\*******************************************************************/
+
+void symex_target_equationt::set_stream_converter(prop_convt &prop_conv)
+{
+  assert(SSA_steps.empty());
+  stream_conv=&prop_conv;
+}
+
+/*******************************************************************\
+
+Function: symex_target_equationt::stream_step
+
+  Inputs: the step just recorded
+
+ Outputs:
+
+ Purpose: when streaming, converts the step, as convert would, and
+          drops the expressions that are only needed for conversion;
+          the assertions are converted under the assumptions before
+          them, and are only required to fail by convert
+
+\*******************************************************************/
+
+void symex_target_equationt::stream_step(SSA_stept &SSA_step)
+{
+  if(stream_conv==NULL)
+    return;
+
+  prop_convt &prop_conv=*stream_conv;
+  streamed_steps++;
+
+  SSA_step.guard_literal=prop_conv.convert(SSA_step.guard);
+  SSA_step.guard=literal_exprt(SSA_step.guard_literal);
+
+  if(SSA_step.is_assignment())
+  {
+    prop_conv.set_to_true(SSA_step.cond_expr);
+    SSA_step.cond_expr=true_exprt();
+    SSA_step.ssa_rhs.make_nil();
+  }
+  else if(SSA_step.is_constraint())
+  {
+    prop_conv.set_to_true(SSA_step.cond_expr);
+    SSA_step.cond_expr=true_exprt();
+  }
+  else if(SSA_step.is_decl())
+  {
+    prop_conv.convert(SSA_step.cond_expr);
+    SSA_step.cond_expr=true_exprt();
+  }
+  else if(SSA_step.is_assume())
+  {
+    SSA_step.cond_literal=prop_conv.convert(SSA_step.cond_expr);
+    stream_assumption=
+      prop_conv.convert(
+        and_exprt(
+          literal_exprt(stream_assumption),
+          literal_exprt(SSA_step.cond_literal)));
+  }
+  else if(SSA_step.is_goto())
+    SSA_step.cond_literal=prop_conv.convert(SSA_step.cond_expr);
+  else if(SSA_step.is_assert())
+    SSA_step.cond_literal=
+      prop_conv.convert(
+        implies_exprt(
+          literal_exprt(stream_assumption),
+          SSA_step.cond_expr));
+
+  if(SSA_step.io.read().io_args.empty())
+    return;
+
+  SSA_stept::io_datat &io=SSA_step.io.write();
+
+  for(const auto &arg : io.io_args)
+  {
+    if(arg.is_constant() ||
+       arg.id()==ID_string_constant)
+      io.converted_io_args.push_back(arg);
+    else
+    {
+      symbol_exprt symbol;
+      symbol.type()=arg.type();
+      symbol.set_identifier(
+        "symex::io::"+std::to_string(stream_io_count++));
+
+      prop_conv.set_to_true(equal_exprt(arg, symbol));
+      io.converted_io_args.push_back(symbol);
+    }
+  }
+}
+
+/*******************************************************************\
+
+Function: symex_target_equationt::convert_stream_assertions
+
+  Inputs: converter
+
+ Outputs:
+
+ Purpose: requires one of the assertions converted when streaming
+          to fail
+
+\*******************************************************************/
+
+void symex_target_equationt::convert_stream_assertions(
+  prop_convt &prop_conv)
+{
+  // steps added by other means than recording them would be lost
+  assert(streamed_steps==SSA_steps.size());
+
+  or_exprt::operandst disjuncts;
+
+  for(const auto &step : SSA_steps)
+    if(step.is_assert())
+      disjuncts.push_back(literal_exprt(!step.cond_literal));
+
+  if(disjuncts.empty())
+    return;
+
+  prop_conv.set_to_true(disjunction(disjuncts));
+}
+
 /*******************************************************************\
 
 Function: symex_target_equationt::merge_ireps
@@ -917,6 +1184,11 @@ Function: symex_target_equationt::merge_ireps
 
 void symex_target_equationt::merge_ireps(SSA_stept &SSA_step)
 {
+  // the merged expressions are kept, which would defeat dropping
+  // them when streaming
+  if(stream_conv!=NULL)
+    return;
+
   merge_irep(SSA_step.guard);
 
   merge_irep(SSA_step.ssa_lhs);
@@ -926,8 +1198,9 @@ void symex_target_equationt::merge_ireps(SSA_stept &SSA_step)
 
   merge_irep(SSA_step.cond_expr);
 
-  for(auto &step : SSA_step.io_args)
-    merge_irep(step);
+  if(!SSA_step.io.read().io_args.empty())
+    for(auto &step : SSA_step.io.write().io_args)
+      merge_irep(step);
 
   // converted_io_args is merged in convert_io
 }
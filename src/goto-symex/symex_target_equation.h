@@ -13,6 +13,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <iosfwd>
 
 #include <util/merge_irep.h>
+#include <util/reference_counting.h>
 
 #include <goto-programs/goto_program.h>
 #include <goto-programs/goto_trace.h>
@@ -162,6 +163,28 @@ public:
   void convert_guards(prop_convt &prop_conv);
   void convert_io(decision_proceduret &decision_procedure);
 
+  // for incremental solving: the constraints of the steps before
+  // 'permanent' hold unconditionally, those of the remaining steps
+  // only if 'activation' is true; the first 'converted' steps have
+  // been passed to 'prop_conv' before
+  void convert_incremental(
+    prop_convt &prop_conv,
+    std::size_t converted,
+    std::size_t permanent,
+    literalt activation);
+
+  // For streaming conversion: the steps are passed to 'prop_conv'
+  // as soon as they are recorded, and the expressions that aren't
+  // needed afterwards are dropped from them. Slicing is thus not
+  // possible, and convert must be given the same converter, and then
+  // only adds the assertions.
+  void set_stream_converter(prop_convt &prop_conv);
+
+  bool is_streaming() const
+  {
+    return stream_conv!=NULL;
+  }
+
   exprt make_expression() const;
 
   class SSA_stept
@@ -196,28 +219,34 @@ public:
     // NOLINTNEXTLINE(whitespace/line_length)
     bool is_atomic_end() const      { return type==goto_trace_stept::ATOMIC_END; }
 
+    // There are millions of steps in large equations; the small
+    // members are grouped to avoid padding, and the ones that few
+    // steps have are kept apart.
+
     // we may choose to hide
     bool hidden;
 
+    // for slicing
+    bool ignore;
+
+    // for ASSIGNMENT and DECL
+    assignment_typet assignment_type;
+
     exprt guard;
     literalt guard_literal;
 
+    // for ASSUME/ASSERT/GOTO/CONSTRAINT
+    literalt cond_literal;
+    exprt cond_expr;
+
     // for ASSIGNMENT and DECL
     ssa_exprt ssa_lhs;
     exprt ssa_full_lhs, original_full_lhs;
     exprt ssa_rhs;
-    assignment_typet assignment_type;
-
-    // for ASSUME/ASSERT/GOTO/CONSTRAINT
-    exprt cond_expr;
-    literalt cond_literal;
-    std::string comment;
 
-    // for INPUT/OUTPUT
-    irep_idt format_string, io_id;
-    bool formatted;
-    std::list<exprt> io_args;
-    std::list<exprt> converted_io_args;
+    // for ASSERT/CONSTRAINT; the same message is usually given to
+    // many steps, which share it
+    irep_idt comment;
 
     // for function call/return
     irep_idt identifier;
@@ -225,23 +254,38 @@ public:
     // for SHARED_READ/SHARED_WRITE and ATOMIC_BEGIN/ATOMIC_END
     unsigned atomic_section_id;
 
-    // for slicing
-    bool ignore;
+    // for INPUT/OUTPUT
+    class io_datat
+    {
+    public:
+      irep_idt format_string, io_id;
+      bool formatted;
+      std::list<exprt> io_args;
+      std::list<exprt> converted_io_args;
+
+      io_datat():formatted(false)
+      {
+      }
+
+      static const io_datat blank;
+    };
+
+    reference_counting<io_datat> io;
 
     SSA_stept():
       type(goto_trace_stept::NONE),
       hidden(false),
+      ignore(false),
+      assignment_type(STATE),
       guard(static_cast<const exprt &>(get_nil_irep())),
       guard_literal(const_literal(false)),
+      cond_literal(const_literal(false)),
+      cond_expr(static_cast<const exprt &>(get_nil_irep())),
       ssa_lhs(static_cast<const ssa_exprt &>(get_nil_irep())),
       ssa_full_lhs(static_cast<const exprt &>(get_nil_irep())),
       original_full_lhs(static_cast<const exprt &>(get_nil_irep())),
       ssa_rhs(static_cast<const exprt &>(get_nil_irep())),
-      cond_expr(static_cast<const exprt &>(get_nil_irep())),
-      cond_literal(const_literal(false)),
-      formatted(false),
-      atomic_section_id(0),
-      ignore(false)
+      atomic_section_id(0)
     {
     }
 
@@ -291,6 +335,9 @@ public:
   void clear()
   {
     SSA_steps.clear();
+    streamed_steps=0;
+    stream_io_count=0;
+    stream_assumption=const_literal(true);
   }
 
   bool has_threads() const
@@ -310,6 +357,14 @@ protected:
   // for enforcing sharing in the expressions stored
   merge_irept merge_irep;
   void merge_ireps(SSA_stept &SSA_step);
+
+  // streaming conversion
+  prop_convt *stream_conv;
+  std::size_t streamed_steps;
+  unsigned stream_io_count;
+  literalt stream_assumption; // conjunction of the assumptions so far
+  void stream_step(SSA_stept &SSA_step);
+  void convert_stream_assertions(prop_convt &prop_conv);
 };
 
 inline bool operator<(
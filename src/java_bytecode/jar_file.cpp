@@ -117,6 +117,14 @@ std::string jar_filet::get_entry(std::size_t i)
     return std::string(""); // error
   }
 
+  // NOLINTNEXTLINE(readability/identifiers)
+  struct zip_stat stat;
+  zip_stat_init(&stat);
+
+  if(zip_stat_index(zip_p, i, 0, &stat)==0 &&
+     (stat.valid&ZIP_STAT_SIZE)!=0)
+    dest.reserve(stat.size);
+
   std::vector<char> buffer;
   buffer.resize(ZIP_READ_SIZE);
 
@@ -138,6 +146,42 @@ std::string jar_filet::get_entry(std::size_t i)
 
 /*******************************************************************\
 
+Function: jar_filet::get_crc
+
+  Inputs: the index of an entry
+
+ Outputs: its CRC, as recorded in the central directory, 0 if unknown
+
+ Purpose:
+
+\*******************************************************************/
+
+unsigned jar_filet::get_crc(std::size_t i)
+{
+  if(zip==nullptr)
+    return 0;
+
+  assert(i<index.size());
+
+  #ifdef HAVE_LIBZIP
+  void *zip_e=zip; // zip is both a type and a non-type
+  // NOLINTNEXTLINE(readability/identifiers)
+  struct zip *zip_p=static_cast<struct zip*>(zip_e);
+
+  // NOLINTNEXTLINE(readability/identifiers)
+  struct zip_stat stat;
+  zip_stat_init(&stat);
+
+  if(zip_stat_index(zip_p, i, 0, &stat)==0 &&
+     (stat.valid&ZIP_STAT_CRC)!=0)
+    return stat.crc;
+  #endif
+
+  return 0;
+}
+
+/*******************************************************************\
+
 Function: jar_filet::get_manifest
 
   Inputs:
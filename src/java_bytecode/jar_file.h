@@ -35,6 +35,10 @@ public:
 
   std::string get_entry(std::size_t i);
 
+  // the CRC of an entry, which changes with its contents, without
+  // reading it; 0 if unknown
+  unsigned get_crc(std::size_t i);
+
   typedef std::map<std::string, std::string> manifestt;
   manifestt get_manifest();
 
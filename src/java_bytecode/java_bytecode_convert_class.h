@@ -14,11 +14,21 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "java_bytecode_parse_tree.h"
 
+// the methods whose bodies haven't been converted yet, with the
+// names of their classes
+typedef std::map<irep_idt,
+                 std::pair<irep_idt,
+                           const java_bytecode_parse_treet::methodt *> >
+  lazy_methodst;
+
+// With 'lazy_methods' given, only the signatures of the methods are
+// converted, and the methods are added to 'lazy_methods'.
 bool java_bytecode_convert_class(
   const java_bytecode_parse_treet &parse_tree,
   symbol_tablet &symbol_table,
   message_handlert &message_handler,
   bool disable_runtime_checks,
-  size_t max_array_length);
+  size_t max_array_length,
+  lazy_methodst *lazy_methods=nullptr);
 
 #endif // CPROVER_JAVA_BYTECODE_JAVA_BYTECODE_CONVERT_CLASS_H
@@ -2154,3 +2154,62 @@ void java_bytecode_convert_method(
 
   java_bytecode_convert_method(class_symbol, method);
 }
+
+/*******************************************************************\
+
+Function: java_bytecode_convert_method_lazy
+
+  Inputs: the class, the name and the parse tree of the method
+
+ Outputs:
+
+ Purpose: Adds the symbol of the method without its body, which
+          is what calls to the method and the dispatch of virtual
+          calls need. If there is a symbol already, it's kept.
+
+\*******************************************************************/
+
+void java_bytecode_convert_method_lazy(
+  const symbolt &class_symbol,
+  const irep_idt &method_identifier,
+  const java_bytecode_parse_treet::methodt &m,
+  symbol_tablet &symbol_table)
+{
+  typet member_type=java_type_from_string(m.signature);
+
+  assert(member_type.id()==ID_code);
+
+  // do we need to add 'this' as a parameter?
+  if(!m.is_static)
+  {
+    code_typet::parameterst &parameters=
+      to_code_type(member_type).parameters();
+    code_typet::parametert this_p;
+    const reference_typet object_ref_type(
+      symbol_typet(class_symbol.name));
+    this_p.type()=object_ref_type;
+    this_p.set_this();
+    parameters.insert(parameters.begin(), this_p);
+  }
+
+  symbolt method_symbol;
+
+  method_symbol.name=method_identifier;
+  method_symbol.base_name=m.base_name;
+  method_symbol.mode=ID_java;
+  method_symbol.location=m.source_location;
+  method_symbol.location.set_function(method_identifier);
+
+  if(m.base_name=="<init>")
+    method_symbol.pretty_name=id2string(class_symbol.pretty_name)+"."+
+                              id2string(class_symbol.base_name)+"()";
+  else
+    method_symbol.pretty_name=id2string(class_symbol.pretty_name)+"."+
+                              id2string(m.base_name)+"()";
+
+  method_symbol.type=member_type;
+  if(m.base_name=="<init>" || m.base_name=="<clinit>")
+    method_symbol.type.set(ID_constructor, true);
+
+  symbol_table.add(method_symbol);
+}
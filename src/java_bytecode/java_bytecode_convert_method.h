@@ -22,4 +22,13 @@ void java_bytecode_convert_method(
   bool disable_runtime_checks,
   size_t max_array_length);
 
+// adds the symbol of the method with its signature, but without
+// its body, which is converted by java_bytecode_convert_method
+// once it's needed
+void java_bytecode_convert_method_lazy(
+  const symbolt &class_symbol,
+  const irep_idt &method_identifier,
+  const java_bytecode_parse_treet::methodt &,
+  symbol_tablet &symbol_table);
+
 #endif // CPROVER_JAVA_BYTECODE_JAVA_BYTECODE_CONVERT_METHOD_H
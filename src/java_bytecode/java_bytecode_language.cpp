@@ -13,9 +13,14 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/config.h>
 #include <util/cmdline.h>
 #include <util/string2int.h>
+#include <util/prefix.h>
+#include <util/std_code.h>
+
+#include <goto-programs/class_hierarchy.h>
 
 #include "java_bytecode_language.h"
 #include "java_bytecode_convert_class.h"
+#include "java_bytecode_convert_method.h"
 #include "java_bytecode_internal_additions.h"
 #include "java_bytecode_typecheck.h"
 #include "java_entry_point.h"
@@ -45,6 +50,9 @@ void java_bytecode_languaget::get_language_options(const cmdlinet &cmd)
       std::stoi(cmd.get_value("java-max-input-array-length"));
   if(cmd.isset("java-max-vla-length"))
     max_user_array_length=std::stoi(cmd.get_value("java-max-vla-length"));
+  lazy_methods_mode=cmd.isset("lazy-methods");
+  java_class_loader.class_cache_directory=
+    cmd.get_value("java-class-cache");
 }
 
 /*******************************************************************\
@@ -165,6 +173,10 @@ bool java_bytecode_languaget::parse(
     java_class_loader(main_class);
   }
 
+  if(!java_class_loader.class_cache_directory.empty())
+    statistics() << "Classes read from the class cache: "
+                 << java_class_loader.class_cache_hits << eom;
+
   return false;
 }
 
@@ -184,6 +196,8 @@ bool java_bytecode_languaget::typecheck(
   symbol_tablet &symbol_table,
   const std::string &module)
 {
+  lazy_methodst lazy_methods;
+
   // first convert all
   for(java_class_loadert::class_mapt::const_iterator
       c_it=java_class_loader.class_map.begin();
@@ -200,10 +214,15 @@ bool java_bytecode_languaget::typecheck(
          symbol_table,
          get_message_handler(),
          disable_runtime_checks,
-         max_user_array_length))
+         max_user_array_length,
+         lazy_methods_mode?&lazy_methods:nullptr))
       return true;
   }
 
+  if(lazy_methods_mode &&
+     do_lazy_method_conversion(symbol_table, lazy_methods))
+    return true;
+
   // now typecheck all
   if(java_bytecode_typecheck(
        symbol_table, get_message_handler()))
@@ -214,6 +233,182 @@ bool java_bytecode_languaget::typecheck(
 
 /*******************************************************************\
 
+Function: java_bytecode_languaget::get_lazy_method_roots
+
+  Inputs: the methods that haven't been converted
+
+ Outputs: the methods the entry point calls
+
+ Purpose: These are the candidates for the main method, which is
+          chosen by java_entry_point, and the static initializers,
+          which it calls for all classes.
+
+\*******************************************************************/
+
+void java_bytecode_languaget::get_lazy_method_roots(
+  const lazy_methodst &lazy_methods,
+  std::vector<irep_idt> &roots)
+{
+  std::string main_prefix;
+
+  if(config.main!="")
+    main_prefix="java::"+config.main;
+  else if(!main_class.empty())
+    main_prefix="java::"+id2string(main_class)+".main:";
+
+  for(const auto &method : lazy_methods)
+  {
+    const std::string &id=id2string(method.first);
+
+    if((!main_prefix.empty() && has_prefix(id, main_prefix)) ||
+       method.second.second->base_name=="<clinit>")
+      roots.push_back(method.first);
+  }
+}
+
+/*******************************************************************\
+
+Function: get_called_functions
+
+  Inputs: the body of a method
+
+ Outputs: the function operands of the calls in it
+
+ Purpose:
+
+\*******************************************************************/
+
+static void get_called_functions(
+  const exprt &expr,
+  std::vector<exprt> &functions)
+{
+  if(expr.id()==ID_code &&
+     to_code(expr).get_statement()==ID_function_call)
+  {
+    functions.push_back(to_code_function_call(to_code(expr)).function());
+    return;
+  }
+
+  forall_operands(it, expr)
+    get_called_functions(*it, functions);
+}
+
+/*******************************************************************\
+
+Function: java_bytecode_languaget::do_lazy_method_conversion
+
+  Inputs: the symbol table with the signatures of all methods, and
+          the methods whose bodies haven't been converted
+
+ Outputs: true on error
+
+ Purpose: Converts the bodies of the methods that may be called from
+          the entry point. The targets of a virtual call are the
+          implementations of the method in the class of the call,
+          in its parents, and in all of its children, as
+          remove_virtual_functions may pick any of these.
+
+\*******************************************************************/
+
+bool java_bytecode_languaget::do_lazy_method_conversion(
+  symbol_tablet &symbol_table,
+  const lazy_methodst &lazy_methods)
+{
+  std::vector<irep_idt> worklist;
+  get_lazy_method_roots(lazy_methods, worklist);
+
+  if(worklist.empty() && config.main=="" && main_class.empty())
+  {
+    // without an entry point, all methods are needed
+    for(const auto &method : lazy_methods)
+      worklist.push_back(method.first);
+  }
+
+  class_hierarchyt class_hierarchy;
+  class_hierarchy(symbol_table);
+
+  std::set<irep_idt> seen;
+  std::size_t converted=0;
+
+  while(!worklist.empty())
+  {
+    const irep_idt method_id=worklist.back();
+    worklist.pop_back();
+
+    if(!seen.insert(method_id).second)
+      continue;
+
+    lazy_methodst::const_iterator m_it=lazy_methods.find(method_id);
+
+    // not a method we've got the bytecode for
+    if(m_it==lazy_methods.end())
+      continue;
+
+    debug() << "Converting method " << method_id << eom;
+    converted++;
+
+    try
+    {
+      java_bytecode_convert_method(
+        symbol_table.lookup(m_it->second.first),
+        *m_it->second.second,
+        symbol_table,
+        get_message_handler(),
+        disable_runtime_checks,
+        max_user_array_length);
+    }
+
+    catch(int)
+    {
+      return true;
+    }
+
+    catch(const char *e)
+    {
+      error() << e << eom;
+      return true;
+    }
+
+    catch(const std::string &e)
+    {
+      error() << e << eom;
+      return true;
+    }
+
+    // now find the methods it calls
+    std::vector<exprt> functions;
+    get_called_functions(symbol_table.lookup(method_id).value, functions);
+
+    for(const auto &function : functions)
+    {
+      if(function.id()==ID_symbol)
+        worklist.push_back(to_symbol_expr(function).get_identifier());
+      else if(function.id()==ID_virtual_function)
+      {
+        const irep_idt &class_id=function.get(ID_C_class);
+        const irep_idt &component_name=function.get(ID_component_name);
+
+        class_hierarchyt::idst classes=
+          class_hierarchy.get_parents_trans(class_id);
+        class_hierarchyt::idst children=
+          class_hierarchy.get_children_trans(class_id);
+        classes.insert(classes.end(), children.begin(), children.end());
+        classes.push_back(class_id);
+
+        for(const auto &c : classes)
+          worklist.push_back(id2string(c)+"."+id2string(component_name));
+      }
+    }
+  }
+
+  status() << "Converted " << converted << " of "
+           << lazy_methods.size() << " methods" << eom;
+
+  return false;
+}
+
+/*******************************************************************\
+
 Function: java_bytecode_languaget::final
 
   Inputs:
@@ -13,6 +13,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/cmdline.h>
 
 #include "java_class_loader.h"
+#include "java_bytecode_convert_class.h"
 
 #define MAX_NONDET_ARRAY_LENGTH_DEFAULT 5
 
@@ -42,7 +43,8 @@ public:
   virtual ~java_bytecode_languaget();
   java_bytecode_languaget():
     max_nondet_array_length(MAX_NONDET_ARRAY_LENGTH_DEFAULT),
-    max_user_array_length(0)
+    max_user_array_length(0),
+    lazy_methods_mode(false)
     {}
 
   bool from_expr(
@@ -82,6 +84,17 @@ protected:
                                     //  - array size for newarray
   size_t max_nondet_array_length;   // maximal length for non-det array creation
   size_t max_user_array_length;     // max size for user code created arrays
+
+  // convert only the bodies of the methods that can be called
+  bool lazy_methods_mode;
+
+  bool do_lazy_method_conversion(
+    symbol_tablet &,
+    const lazy_methodst &);
+
+  void get_lazy_method_roots(
+    const lazy_methodst &,
+    std::vector<irep_idt> &roots);
 };
 
 languaget *new_java_bytecode_language();
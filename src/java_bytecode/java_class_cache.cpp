@@ -0,0 +1,558 @@
+/*******************************************************************\
+
+Module: Cache of Parse Trees of Class Files
+
+Author:
+
+\*******************************************************************/
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+#include <util/irep_serialization.h>
+#include <util/string_hash.h>
+
+#include "java_class_cache.h"
+
+// the version of the format, to be increased when the parse tree
+// changes
+#define JAVA_CLASS_CACHE_VERSION 1
+
+/*******************************************************************\
+
+Function: java_class_cachet::file_name
+
+  Inputs: a JAR file, the name of a class file in it, and its CRC
+
+ Outputs: the file of the parse tree of the class file in the cache
+
+ Purpose:
+
+\*******************************************************************/
+
+std::string java_class_cachet::file_name(
+  const std::string &jar_file,
+  const std::string &entry,
+  unsigned crc) const
+{
+  std::ostringstream name;
+
+  name << directory
+       #ifdef _WIN32
+       << '\\'
+       #else
+       << '/'
+       #endif
+       << std::hex << hash_string(jar_file+'!'+entry)
+       << '-' << crc << ".jpt";
+
+  return name.str();
+}
+
+/*******************************************************************\
+
+Function: write_annotations
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+static void write_annotations(
+  std::ostream &out,
+  const java_bytecode_parse_treet::annotationst &annotations,
+  irep_serializationt &irepconverter)
+{
+  write_gb_word(out, annotations.size());
+
+  for(const auto &annotation : annotations)
+  {
+    irepconverter.reference_convert(annotation.type, out);
+    write_gb_word(out, annotation.element_value_pairs.size());
+
+    for(const auto &pair : annotation.element_value_pairs)
+    {
+      irepconverter.write_string_ref(out, pair.element_name);
+      irepconverter.reference_convert(pair.value, out);
+    }
+  }
+}
+
+/*******************************************************************\
+
+Function: read_annotations
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+static void read_annotations(
+  std::istream &in,
+  java_bytecode_parse_treet::annotationst &annotations,
+  irep_serializationt &irepconverter)
+{
+  annotations.resize(irepconverter.read_gb_word(in));
+
+  for(auto &annotation : annotations)
+  {
+    irepconverter.reference_convert(in, annotation.type);
+    annotation.element_value_pairs.resize(irepconverter.read_gb_word(in));
+
+    for(auto &pair : annotation.element_value_pairs)
+    {
+      pair.element_name=irepconverter.read_string_ref(in);
+      irepconverter.reference_convert(in, pair.value);
+    }
+  }
+}
+
+/*******************************************************************\
+
+Function: write_member
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+static void write_member(
+  std::ostream &out,
+  const java_bytecode_parse_treet::membert &member,
+  irep_serializationt &irepconverter)
+{
+  irepconverter.write_string_ref(out, member.signature);
+  irepconverter.write_string_ref(out, member.name);
+
+  unsigned flags=0;
+  flags=(flags<<1) | static_cast<int>(member.is_public);
+  flags=(flags<<1) | static_cast<int>(member.is_protected);
+  flags=(flags<<1) | static_cast<int>(member.is_private);
+  flags=(flags<<1) | static_cast<int>(member.is_static);
+  flags=(flags<<1) | static_cast<int>(member.is_final);
+  write_gb_word(out, flags);
+
+  write_annotations(out, member.annotations, irepconverter);
+}
+
+/*******************************************************************\
+
+Function: read_member
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+static void read_member(
+  std::istream &in,
+  java_bytecode_parse_treet::membert &member,
+  irep_serializationt &irepconverter)
+{
+  member.signature=id2string(irepconverter.read_string_ref(in));
+  member.name=irepconverter.read_string_ref(in);
+
+  unsigned flags=irepconverter.read_gb_word(in);
+  member.is_final=(flags&1)!=0;
+  member.is_static=(flags&2)!=0;
+  member.is_private=(flags&4)!=0;
+  member.is_protected=(flags&8)!=0;
+  member.is_public=(flags&16)!=0;
+
+  read_annotations(in, member.annotations, irepconverter);
+}
+
+/*******************************************************************\
+
+Function: write_verification_type_infos
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+static void write_verification_type_infos(
+  std::ostream &out,
+  const std::vector<java_bytecode_parse_treet::methodt::
+                      verification_type_infot> &infos)
+{
+  write_gb_word(out, infos.size());
+
+  for(const auto &info : infos)
+  {
+    write_gb_word(out, info.type);
+    write_gb_word(out, info.tag);
+    write_gb_word(out, info.cpool_index);
+    write_gb_word(out, info.offset);
+  }
+}
+
+/*******************************************************************\
+
+Function: read_verification_type_infos
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+static void read_verification_type_infos(
+  std::istream &in,
+  std::vector<java_bytecode_parse_treet::methodt::
+                verification_type_infot> &infos)
+{
+  typedef java_bytecode_parse_treet::methodt::verification_type_infot
+    verification_type_infot;
+
+  infos.resize(irep_serializationt::read_gb_word(in));
+
+  for(auto &info : infos)
+  {
+    info.type=static_cast<verification_type_infot::
+                            verification_type_info_type>(
+      irep_serializationt::read_gb_word(in));
+    info.tag=irep_serializationt::read_gb_word(in);
+    info.cpool_index=irep_serializationt::read_gb_word(in);
+    info.offset=irep_serializationt::read_gb_word(in);
+  }
+}
+
+/*******************************************************************\
+
+Function: write_method
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+static void write_method(
+  std::ostream &out,
+  const java_bytecode_parse_treet::methodt &method,
+  irep_serializationt &irepconverter)
+{
+  write_member(out, method, irepconverter);
+
+  irepconverter.write_string_ref(out, method.base_name);
+
+  unsigned flags=0;
+  flags=(flags<<1) | static_cast<int>(method.is_native);
+  flags=(flags<<1) | static_cast<int>(method.is_abstract);
+  flags=(flags<<1) | static_cast<int>(method.is_synchronized);
+  write_gb_word(out, flags);
+
+  irepconverter.reference_convert(method.source_location, out);
+
+  write_gb_word(out, method.instructions.size());
+
+  for(const auto &instruction : method.instructions)
+  {
+    irepconverter.reference_convert(instruction.source_location, out);
+    write_gb_word(out, instruction.address);
+    irepconverter.write_string_ref(out, instruction.statement);
+    write_gb_word(out, instruction.args.size());
+
+    for(const auto &arg : instruction.args)
+      irepconverter.reference_convert(arg, out);
+  }
+
+  write_gb_word(out, method.exception_table.size());
+
+  for(const auto &exception : method.exception_table)
+  {
+    write_gb_word(out, exception.start_pc);
+    write_gb_word(out, exception.end_pc);
+    write_gb_word(out, exception.handler_pc);
+    irepconverter.reference_convert(exception.catch_type, out);
+  }
+
+  write_gb_word(out, method.local_variable_table.size());
+
+  for(const auto &local_variable : method.local_variable_table)
+  {
+    irepconverter.write_string_ref(out, local_variable.name);
+    irepconverter.write_string_ref(out, local_variable.signature);
+    write_gb_word(out, local_variable.index);
+    write_gb_word(out, local_variable.start_pc);
+    write_gb_word(out, local_variable.length);
+  }
+
+  write_gb_word(out, method.stack_map_table.size());
+
+  for(const auto &entry : method.stack_map_table)
+  {
+    write_gb_word(out, entry.type);
+    write_gb_word(out, entry.offset_delta);
+    write_gb_word(out, entry.chops);
+    write_gb_word(out, entry.appends);
+    write_verification_type_infos(out, entry.locals);
+    write_verification_type_infos(out, entry.stack);
+  }
+}
+
+/*******************************************************************\
+
+Function: read_method
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+static void read_method(
+  std::istream &in,
+  java_bytecode_parse_treet::methodt &method,
+  irep_serializationt &irepconverter)
+{
+  typedef java_bytecode_parse_treet::methodt::stack_map_table_entryt
+    stack_map_table_entryt;
+
+  read_member(in, method, irepconverter);
+
+  method.base_name=irepconverter.read_string_ref(in);
+
+  unsigned flags=irepconverter.read_gb_word(in);
+  method.is_synchronized=(flags&1)!=0;
+  method.is_abstract=(flags&2)!=0;
+  method.is_native=(flags&4)!=0;
+
+  irepconverter.reference_convert(in, method.source_location);
+
+  method.instructions.resize(irepconverter.read_gb_word(in));
+
+  for(auto &instruction : method.instructions)
+  {
+    irepconverter.reference_convert(in, instruction.source_location);
+    instruction.address=irepconverter.read_gb_word(in);
+    instruction.statement=irepconverter.read_string_ref(in);
+    instruction.args.resize(irepconverter.read_gb_word(in));
+
+    for(auto &arg : instruction.args)
+      irepconverter.reference_convert(in, arg);
+  }
+
+  method.exception_table.resize(irepconverter.read_gb_word(in));
+
+  for(auto &exception : method.exception_table)
+  {
+    exception.start_pc=irepconverter.read_gb_word(in);
+    exception.end_pc=irepconverter.read_gb_word(in);
+    exception.handler_pc=irepconverter.read_gb_word(in);
+    irepconverter.reference_convert(in, exception.catch_type);
+  }
+
+  method.local_variable_table.resize(irepconverter.read_gb_word(in));
+
+  for(auto &local_variable : method.local_variable_table)
+  {
+    local_variable.name=irepconverter.read_string_ref(in);
+    local_variable.signature=
+      id2string(irepconverter.read_string_ref(in));
+    local_variable.index=irepconverter.read_gb_word(in);
+    local_variable.start_pc=irepconverter.read_gb_word(in);
+    local_variable.length=irepconverter.read_gb_word(in);
+  }
+
+  method.stack_map_table.resize(irepconverter.read_gb_word(in));
+
+  for(auto &entry : method.stack_map_table)
+  {
+    entry.type=static_cast<stack_map_table_entryt::stack_frame_type>(
+      irepconverter.read_gb_word(in));
+    entry.offset_delta=irepconverter.read_gb_word(in);
+    entry.chops=irepconverter.read_gb_word(in);
+    entry.appends=irepconverter.read_gb_word(in);
+    read_verification_type_infos(in, entry.locals);
+    read_verification_type_infos(in, entry.stack);
+  }
+}
+
+/*******************************************************************\
+
+Function: java_class_cachet::write
+
+  Inputs: a JAR file, the name of a class file in it, its CRC, and
+          its parse tree
+
+ Outputs: true on error
+
+ Purpose: The parse tree is written to a file of its own, which is
+          then renamed, as another process may be reading it.
+
+\*******************************************************************/
+
+bool java_class_cachet::write(
+  const std::string &jar_file,
+  const std::string &entry,
+  unsigned crc,
+  const java_bytecode_parse_treet &parse_tree) const
+{
+  const std::string file=file_name(jar_file, entry, crc);
+  const std::string tmp=file+"."+std::to_string(getpid());
+
+  {
+    std::ofstream out(tmp, std::ios::binary);
+
+    if(!out)
+      return true;
+
+    irep_serializationt::ireps_containert ireps_container;
+    irep_serializationt irepconverter(ireps_container);
+
+    write_gb_word(out, JAVA_CLASS_CACHE_VERSION);
+    // the key, as the names of the files may collide
+    write_gb_string(out, jar_file+'!'+entry);
+
+    const java_bytecode_parse_treet::classt &parsed_class=
+      parse_tree.parsed_class;
+
+    irepconverter.write_string_ref(out, parsed_class.name);
+    irepconverter.write_string_ref(out, parsed_class.extends);
+
+    unsigned flags=0;
+    flags=(flags<<1) | static_cast<int>(parse_tree.loading_successful);
+    flags=(flags<<1) | static_cast<int>(parsed_class.is_abstract);
+    flags=(flags<<1) | static_cast<int>(parsed_class.is_enum);
+    write_gb_word(out, flags);
+    write_gb_word(out, parsed_class.enum_elements);
+
+    write_gb_word(out, parsed_class.implements.size());
+    for(const auto &i : parsed_class.implements)
+      irepconverter.write_string_ref(out, i);
+
+    write_gb_word(out, parsed_class.fields.size());
+    for(const auto &field : parsed_class.fields)
+    {
+      write_member(out, field, irepconverter);
+      write_gb_word(out, field.is_enum);
+    }
+
+    write_gb_word(out, parsed_class.methods.size());
+    for(const auto &method : parsed_class.methods)
+      write_method(out, method, irepconverter);
+
+    write_annotations(out, parsed_class.annotations, irepconverter);
+
+    write_gb_word(out, parse_tree.class_refs.size());
+    for(const auto &class_ref : parse_tree.class_refs)
+      irepconverter.write_string_ref(out, class_ref);
+
+    if(!out)
+    {
+      out.close();
+      std::remove(tmp.c_str());
+      return true;
+    }
+  }
+
+  return std::rename(tmp.c_str(), file.c_str())!=0;
+}
+
+/*******************************************************************\
+
+Function: java_class_cachet::read
+
+  Inputs: a JAR file, the name of a class file in it, and its CRC
+
+ Outputs: true if the cache has the class file, false otherwise
+
+ Purpose: reads the parse tree of the class file from the cache
+
+\*******************************************************************/
+
+bool java_class_cachet::read(
+  const std::string &jar_file,
+  const std::string &entry,
+  unsigned crc,
+  java_bytecode_parse_treet &parse_tree) const
+{
+  std::ifstream in(file_name(jar_file, entry, crc), std::ios::binary);
+
+  if(!in)
+    return false;
+
+  irep_serializationt::ireps_containert ireps_container;
+  irep_serializationt irepconverter(ireps_container);
+
+  if(irepconverter.read_gb_word(in)!=JAVA_CLASS_CACHE_VERSION ||
+     irepconverter.read_gb_string(in)!=jar_file+'!'+entry)
+    return false;
+
+  java_bytecode_parse_treet result;
+  java_bytecode_parse_treet::classt &parsed_class=result.parsed_class;
+
+  try
+  {
+    parsed_class.name=irepconverter.read_string_ref(in);
+    parsed_class.extends=irepconverter.read_string_ref(in);
+
+    unsigned flags=irepconverter.read_gb_word(in);
+    parsed_class.is_enum=(flags&1)!=0;
+    parsed_class.is_abstract=(flags&2)!=0;
+    result.loading_successful=(flags&4)!=0;
+    parsed_class.enum_elements=irepconverter.read_gb_word(in);
+
+    for(std::size_t i=irepconverter.read_gb_word(in); i>0 && in; i--)
+      parsed_class.implements.push_back(irepconverter.read_string_ref(in));
+
+    for(std::size_t i=irepconverter.read_gb_word(in); i>0 && in; i--)
+    {
+      java_bytecode_parse_treet::fieldt &field=parsed_class.add_field();
+      read_member(in, field, irepconverter);
+      field.is_enum=irepconverter.read_gb_word(in)!=0;
+    }
+
+    for(std::size_t i=irepconverter.read_gb_word(in); i>0 && in; i--)
+      read_method(in, parsed_class.add_method(), irepconverter);
+
+    read_annotations(in, parsed_class.annotations, irepconverter);
+
+    for(std::size_t i=irepconverter.read_gb_word(in); i>0 && in; i--)
+      result.class_refs.insert(irepconverter.read_string_ref(in));
+  }
+
+  catch(int)
+  {
+    return false;
+  }
+
+  // a file that is cut short is a miss
+  if(!in)
+    return false;
+
+  parse_tree.swap(result);
+
+  return true;
+}
@@ -0,0 +1,54 @@
+/*******************************************************************\
+
+Module: Cache of Parse Trees of Class Files
+
+Author:
+
+\*******************************************************************/
+
+#ifndef CPROVER_JAVA_BYTECODE_JAVA_CLASS_CACHE_H
+#define CPROVER_JAVA_BYTECODE_JAVA_CLASS_CACHE_H
+
+#include <string>
+
+#include "java_bytecode_parse_tree.h"
+
+// The parse trees of class files in JAR files, one file each in
+// a directory. They are keyed by the path of the JAR file, the
+// name of the class file in it, and its CRC, which changes with
+// the class file. Reading a parse tree is cheaper than inflating
+// and parsing the class file, as the ireps in it are written once
+// only, and shared on reading.
+
+class java_class_cachet
+{
+public:
+  explicit java_class_cachet(const std::string &_directory):
+    directory(_directory)
+  {
+  }
+
+  // true if the cache has the class file, and parse_tree is set
+  bool read(
+    const std::string &jar_file,
+    const std::string &entry,
+    unsigned crc,
+    java_bytecode_parse_treet &parse_tree) const;
+
+  // true on error
+  bool write(
+    const std::string &jar_file,
+    const std::string &entry,
+    unsigned crc,
+    const java_bytecode_parse_treet &parse_tree) const;
+
+protected:
+  const std::string directory;
+
+  std::string file_name(
+    const std::string &jar_file,
+    const std::string &entry,
+    unsigned crc) const;
+};
+
+#endif // CPROVER_JAVA_BYTECODE_JAVA_CLASS_CACHE_H
@@ -13,8 +13,10 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/suffix.h>
 #include <util/prefix.h>
 #include <util/config.h>
+#include <util/file_util.h>
 
 #include "java_bytecode_parser.h"
+#include "java_class_cache.h"
 #include "java_class_loader.h"
 #include "jar_file.h"
 
@@ -84,29 +86,23 @@ java_bytecode_parse_treet &java_class_loadert::get_parse_tree(
 {
   java_bytecode_parse_treet &parse_tree=class_map[class_name];
 
+  read_jar_files();
+
+  // the JAR files that have the class
+  class_jar_indext::const_iterator jar_it=class_jar_index.find(class_name);
+
+  static const jar_entriest no_jar_entries;
+  const jar_entriest &jar_entries=
+    jar_it==class_jar_index.end()?no_jar_entries:jar_it->second;
+
   // First check given JAR files
   for(const auto &jf : jar_files)
   {
-    read_jar_file(jf);
+    const jar_entryt *jar_entry=find_jar_entry(jar_entries, jf);
 
-    const auto &jm=jar_map[jf];
-
-    auto jm_it=jm.entries.find(class_name);
-
-    if(jm_it!=jm.entries.end())
+    if(jar_entry!=NULL)
     {
-      debug() << "Getting class `" << class_name << "' from JAR "
-              << jf << eom;
-
-      std::string data=jar_pool(jf).get_entry(jm_it->second.index);
-
-      std::istringstream istream(data);
-
-      java_bytecode_parse(
-        istream,
-        parse_tree,
-        get_message_handler());
-
+      get_class_from_jar(class_name, *jar_entry, parse_tree);
       return parse_tree;
     }
   }
@@ -118,30 +114,15 @@ java_bytecode_parse_treet &java_class_loadert::get_parse_tree(
     // in a JAR?
     if(has_suffix(cp, ".jar"))
     {
-      read_jar_file(cp);
-
-      const auto &jm=jar_map[cp];
-
-      auto jm_it=jm.entries.find(class_name);
+      const jar_entryt *jar_entry=find_jar_entry(jar_entries, cp);
 
-      if(jm_it!=jm.entries.end())
+      if(jar_entry!=NULL)
       {
-        debug() << "Getting class `" << class_name << "' from JAR "
-                << cp << eom;
-
-        std::string data=jar_pool(cp).get_entry(jm_it->second.index);
-
-        std::istringstream istream(data);
-
-        java_bytecode_parse(
-          istream,
-          parse_tree,
-          get_message_handler());
-
+        get_class_from_jar(class_name, *jar_entry, parse_tree);
         return parse_tree;
       }
     }
-    else
+    else if(has_package_directory(cp, class_name))
     {
       // in a given directory?
       std::string full_path=
@@ -170,6 +151,157 @@ java_bytecode_parse_treet &java_class_loadert::get_parse_tree(
 
 /*******************************************************************\
 
+Function: java_class_loadert::get_class_from_jar
+
+  Inputs: a class name, its entry in a JAR file, and the parse tree
+          to fill in
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void java_class_loadert::get_class_from_jar(
+  const irep_idt &class_name,
+  const jar_entryt &jar_entry,
+  java_bytecode_parse_treet &parse_tree)
+{
+  debug() << "Getting class `" << class_name << "' from JAR "
+          << jar_entry.jar_file << eom;
+
+  const std::string &jar_file_name=id2string(jar_entry.jar_file);
+  jar_filet &jar_file=jar_pool(jar_file_name);
+  const std::string &entry=jar_file.index[jar_entry.index];
+
+  // a CRC of 0 is unknown, and can't tell apart versions of the
+  // class file
+  unsigned crc=
+    class_cache_directory.empty()?0:jar_file.get_crc(jar_entry.index);
+
+  const java_class_cachet class_cache(class_cache_directory);
+
+  if(crc!=0 && class_cache.read(jar_file_name, entry, crc, parse_tree))
+  {
+    class_cache_hits++;
+    return;
+  }
+
+  std::string data=jar_file.get_entry(jar_entry.index);
+
+  std::istringstream istream(data);
+
+  if(!java_bytecode_parse(
+       istream,
+       parse_tree,
+       get_message_handler()) &&
+     crc!=0 &&
+     class_cache.write(jar_file_name, entry, crc, parse_tree))
+  {
+    warning() << "failed to write to the class cache `"
+              << class_cache_directory << "'" << eom;
+    class_cache_directory.clear();
+  }
+}
+
+/*******************************************************************\
+
+Function: java_class_loadert::find_jar_entry
+
+  Inputs: the entries of a class in the JAR files, and a JAR file
+
+ Outputs: the entry of the class in the given JAR file, if any,
+          NULL otherwise
+
+ Purpose:
+
+\*******************************************************************/
+
+const java_class_loadert::jar_entryt *java_class_loadert::find_jar_entry(
+  const jar_entriest &jar_entries,
+  const std::string &jar_file)
+{
+  for(const auto &jar_entry : jar_entries)
+    if(id2string(jar_entry.jar_file)==jar_file)
+      return &jar_entry;
+
+  return NULL;
+}
+
+/*******************************************************************\
+
+Function: java_class_loadert::read_jar_files
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: read the given JAR files, and the ones on the class path,
+          which adds their classes to the index
+
+\*******************************************************************/
+
+void java_class_loadert::read_jar_files()
+{
+  for(const auto &jf : jar_files)
+    read_jar_file(jf);
+
+  // the class path doesn't change
+  if(class_path_jar_files_read)
+    return;
+
+  for(const auto &cp : config.java.classpath)
+    if(has_suffix(cp, ".jar"))
+      read_jar_file(cp);
+
+  class_path_jar_files_read=true;
+}
+
+/*******************************************************************\
+
+Function: java_class_loadert::has_package_directory
+
+  Inputs: a directory on the class path, and a class name
+
+ Outputs: false if the directory can't have the class
+
+ Purpose:
+
+\*******************************************************************/
+
+bool java_class_loadert::has_package_directory(
+  const std::string &class_path_entry,
+  const irep_idt &class_name)
+{
+  const std::string &name=id2string(class_name);
+  std::size_t last_dot=name.rfind('.');
+
+  // the default package is the directory itself
+  if(last_dot==std::string::npos)
+    return true;
+
+  std::string package_dir=
+    #ifdef _WIN32
+    class_path_entry+'\\'+
+    #else
+    class_path_entry+'/'+
+    #endif
+    class_name_to_file(std::string(name, 0, last_dot));
+
+  // strip the .class suffix
+  package_dir.resize(package_dir.size()-6);
+
+  std::pair<directory_cachet::iterator, bool> entry=
+    directory_cache.insert(std::make_pair(package_dir, false));
+
+  if(entry.second)
+    entry.first->second=is_directory(package_dir);
+
+  return entry.first->second;
+}
+
+/*******************************************************************\
+
 Function: java_class_loadert::load_entire_jar
 
   Inputs:
@@ -212,6 +344,9 @@ void java_class_loadert::read_jar_file(const irep_idt &file)
   if(jar_map.find(file)!=jar_map.end())
     return;
 
+  // a file that can't be read is tried once only
+  auto &jm=jar_map[file];
+
   #ifndef HAVE_LIBZIP
   error() << "no support for reading JAR files configured" << eom;
   return;
@@ -226,8 +361,6 @@ void java_class_loadert::read_jar_file(const irep_idt &file)
   }
 
   debug() << "adding JAR file `" << file << "'" << eom;
-
-  auto &jm=jar_map[file];
   std::size_t number_of_files=jar_file.index.size();
 
   for(std::size_t i=0; i<number_of_files; i++)
@@ -241,6 +374,11 @@ void java_class_loadert::read_jar_file(const irep_idt &file)
 
       // record
       jm.entries[class_name].index=i;
+
+      jar_entriest &jar_entries=class_jar_index[class_name];
+      jar_entries.push_back(jar_entryt());
+      jar_entries.back().jar_file=file;
+      jar_entries.back().index=i;
     }
   }
 }
@@ -10,6 +10,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #define CPROVER_JAVA_BYTECODE_JAVA_CLASS_LOADER_H
 
 #include <map>
+#include <vector>
 
 #include <util/message.h>
 
@@ -19,6 +20,12 @@ Author: Daniel Kroening, kroening@kroening.com
 class java_class_loadert:public messaget
 {
 public:
+  java_class_loadert():
+    class_cache_hits(0),
+    class_path_jar_files_read(false)
+  {
+  }
+
   java_bytecode_parse_treet &operator()(const irep_idt &);
 
   // maps class names to the parse trees
@@ -37,6 +44,13 @@ public:
 
   jar_poolt jar_pool;
 
+  // the directory of a java_class_cachet for the classes in JAR
+  // files, none if empty
+  std::string class_cache_directory;
+
+  // statistics
+  std::size_t class_cache_hits;
+
 protected:
   class jar_map_entryt
   {
@@ -57,9 +71,46 @@ protected:
 
   void read_jar_file(const irep_idt &);
 
+  // The JAR files that have a class, with the index of the class in
+  // them. A JAR file is added to this once, when it is read, so that
+  // finding a class takes one lookup, rather than one per JAR file.
+  struct jar_entryt
+  {
+    irep_idt jar_file;
+    std::size_t index;
+  };
+
+  typedef std::vector<jar_entryt> jar_entriest;
+  typedef std::map<irep_idt, jar_entriest> class_jar_indext;
+  class_jar_indext class_jar_index;
+
+  // reads the JAR files that are searched, unless done already
+  void read_jar_files();
+  bool class_path_jar_files_read;
+
+  static const jar_entryt *find_jar_entry(
+    const jar_entriest &,
+    const std::string &jar_file);
+
   // get a parse tree for given class
   java_bytecode_parse_treet &get_parse_tree(const irep_idt &);
 
+  void get_class_from_jar(
+    const irep_idt &class_name,
+    const jar_entryt &,
+    java_bytecode_parse_treet &);
+
+  // Whether the directories of the packages exist. Most classes
+  // aren't in most directories on the class path, and looking for
+  // the directory of their package once per directory is much
+  // cheaper than looking for each class file.
+  typedef std::map<std::string, bool> directory_cachet;
+  directory_cachet directory_cache;
+
+  bool has_package_directory(
+    const std::string &class_path_entry,
+    const irep_idt &class_name);
+
   std::list<std::string> jar_files;
 };
 
@@ -1352,6 +1352,9 @@ void linkingt::do_type_dependencies(id_sett &needs_to_be_renamed)
   // Any type that uses a symbol that will be renamed also
   // needs to be renamed, and so on, until saturation.
 
+  if(needs_to_be_renamed.empty())
+    return;
+
   used_byt used_by;
 
   forall_symbols(s_it, src_symbol_table.symbols)
@@ -1460,9 +1463,17 @@ Function: linkingt::copy_symbols
 
 void linkingt::copy_symbols()
 {
+  // the identical symbols that the renaming changes
+  id_sett changed;
+
   // First apply the renaming
   Forall_symbols(s_it, src_symbol_table.symbols)
   {
+    if(is_identical(s_it->first) &&
+       (rename_symbol.have_to_rename(s_it->second.type) ||
+        rename_symbol.have_to_rename(s_it->second.value)))
+      changed.insert(s_it->first);
+
     // apply the renaming
     rename_symbol(s_it->second.type);
     rename_symbol(s_it->second.value);
@@ -1489,7 +1500,8 @@ void linkingt::copy_symbols()
         // new
         main_symbol_table.add(s_it->second);
       }
-      else
+      else if(!is_identical(s_it->first) ||
+              changed.find(s_it->first)!=changed.end())
         collisions.insert(s_it->first);
     }
   }
@@ -1538,6 +1550,7 @@ void linkingt::typecheck()
       m_it=main_symbol_table.symbols.find(s_it->first);
 
     if(m_it!=main_symbol_table.symbols.end() && // duplicate
+       !is_identical(s_it->first) &&
        needs_renaming(m_it->second, s_it->second))
     {
       needs_to_be_renamed.insert(s_it->first);
@@ -22,6 +22,7 @@ public:
     symbol_tablet &_src_symbol_table,
     message_handlert &_message_handler):
     typecheckt(_message_handler),
+    identical_symbols(nullptr),
     main_symbol_table(_main_symbol_table),
     src_symbol_table(_src_symbol_table),
     ns(_main_symbol_table)
@@ -32,9 +33,21 @@ public:
 
   rename_symbolt rename_symbol;
 
-protected:
   typedef std::unordered_set<irep_idt, irep_id_hash> id_sett;
 
+  // Symbols of the source that are known to be equal to the ones
+  // of the same name in the main symbol table, with the same flags.
+  // These need neither renaming nor merging, unless the renaming
+  // of other symbols changes them.
+  const id_sett *identical_symbols;
+
+protected:
+  bool is_identical(const irep_idt &identifier) const
+  {
+    return identical_symbols!=nullptr &&
+           identical_symbols->find(identifier)!=identical_symbols->end();
+  }
+
   bool needs_renaming_type(
     const symbolt &old_symbol,
     const symbolt &new_symbol);
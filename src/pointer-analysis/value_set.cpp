@@ -7,6 +7,8 @@ Author: Daniel Kroening, kroening@kroening.com
 \*******************************************************************/
 
 #include <cassert>
+#include <list>
+#include <map>
 #include <ostream>
 
 #include <util/symbol_table.h>
@@ -83,10 +85,7 @@ value_sett::entryt &value_sett::get_entry(
   else
     index=e.identifier;
 
-  std::pair<valuest::iterator, bool> r=
-    values.insert(std::pair<idt, entryt>(index, e));
-
-  return r.first->second;
+  return values.insert(index, e).first;
 }
 
 /*******************************************************************\
@@ -142,14 +141,24 @@ void value_sett::output(
   const namespacet &ns,
   std::ostream &out) const
 {
+  // the values aren't ordered, but the output should be
+  typedef std::map<idt, const entryt *> sorted_valuest;
+  sorted_valuest sorted_values;
+
   for(valuest::const_iterator
       v_it=values.begin();
       v_it!=values.end();
       v_it++)
+    sorted_values[v_it->first]=&v_it->second;
+
+  for(sorted_valuest::const_iterator
+      v_it=sorted_values.begin();
+      v_it!=sorted_values.end();
+      v_it++)
   {
     irep_idt identifier, display_name;
 
-    const entryt &e=v_it->second;
+    const entryt &e=*v_it->second;
 
     if(has_prefix(id2string(e.identifier), "value_set::dynamic_object"))
     {
@@ -276,36 +285,42 @@ bool value_sett::make_union(const value_sett::valuest &new_values)
 {
   bool result=false;
 
-  valuest::iterator v_it=values.begin();
+  // the entries that the two share can't add anything
+  valuest::delta_viewt delta_view;
+  new_values.get_delta_view(values, delta_view);
 
-  for(valuest::const_iterator
-      it=new_values.begin();
-      it!=new_values.end();
-      ) // no it++
+  // Changing the values invalidates the pointers into them, so
+  // these are only looked at before.
+  valuest::delta_viewt new_entries;
+
+  for(valuest::delta_viewt::const_iterator
+      it=delta_view.begin();
+      it!=delta_view.end();
+      it++)
   {
-    if(v_it==values.end() || it->first<v_it->first)
-    {
-      values.insert(v_it, *it);
-      result=true;
-      it++;
+    if(it->value==NULL)
       continue;
-    }
-    else if(v_it->first<it->first)
-    {
-      v_it++;
-      continue;
-    }
 
-    assert(v_it->first==it->first);
+    if(it->other_value==NULL ||
+       it->value->object_map.get_d()!=it->other_value->object_map.get_d())
+      new_entries.push_back(*it);
+  }
 
-    entryt &e=v_it->second;
-    const entryt &new_e=it->second;
+  for(valuest::delta_viewt::const_iterator
+      it=new_entries.begin();
+      it!=new_entries.end();
+      it++)
+  {
+    std::pair<entryt &, bool> r=values.insert(*it->key, *it->value);
 
-    if(make_union(e.object_map, new_e.object_map))
+    if(r.second)
+    {
       result=true;
+      continue;
+    }
 
-    v_it++;
-    it++;
+    if(make_union(r.first.object_map, it->value->object_map))
+      result=true;
   }
 
   return result;
@@ -325,17 +340,105 @@ Function: value_sett::make_union
 
 bool value_sett::make_union(object_mapt &dest, const object_mapt &src) const
 {
-  bool result=false;
+  // the same map, or nothing to add
+  if(dest.get_d()==src.get_d() || src.read().empty())
+    return false;
 
-  for(object_map_dt::const_iterator it=src.read().begin();
-      it!=src.read().end();
-      it++)
+  if(dest.read().empty())
   {
-    if(insert(dest, it))
-      result=true;
+    dest=src;
+    return true;
   }
 
-  return result;
+  if(dest.read().includes(src.read()))
+    return false;
+
+  // build the union in a new map, rather than copying dest first
+  object_mapt result;
+  result.write().make_union(dest.read(), src.read());
+  dest.swap(result);
+
+  return true;
+}
+
+/*******************************************************************\
+
+Function: value_sett::object_map_dt::includes
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bool value_sett::object_map_dt::includes(const object_map_dt &other) const
+{
+  if(other.size()>size())
+    return false;
+
+  const_iterator it=begin();
+
+  for(const auto &entry : other)
+  {
+    it=std::lower_bound(it, end(), entry.first, number_less);
+
+    if(it==end() || it->first!=entry.first)
+      return false;
+
+    // an unset offset covers all
+    if(it->second.offset_is_set &&
+       (!entry.second.offset_is_set ||
+        it->second.offset!=entry.second.offset))
+      return false;
+  }
+
+  return true;
+}
+
+/*******************************************************************\
+
+Function: value_sett::object_map_dt::make_union
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void value_sett::object_map_dt::make_union(
+  const object_map_dt &a,
+  const object_map_dt &b)
+{
+  data.clear();
+  data.reserve(a.size()+b.size());
+
+  const_iterator a_it=a.begin(), b_it=b.begin();
+
+  while(a_it!=a.end() && b_it!=b.end())
+  {
+    if(a_it->first<b_it->first)
+      data.push_back(*(a_it++));
+    else if(b_it->first<a_it->first)
+      data.push_back(*(b_it++));
+    else
+    {
+      data.push_back(*a_it);
+
+      if(!b_it->second.offset_is_set ||
+         a_it->second.offset!=b_it->second.offset)
+        data.back().second.offset_is_set=false;
+
+      a_it++;
+      b_it++;
+    }
+  }
+
+  data.insert(data.end(), a_it, a.end());
+  data.insert(data.end(), b_it, b.end());
 }
 
 /*******************************************************************\
@@ -678,8 +781,9 @@ void value_sett::get_value_set_rec(
         }
         else
         {
-          // use as is
-          dest.write().insert(tmp.read().begin(), tmp.read().end());
+          // use as is; an object that is in dest already, but with
+          // a different offset, ends up with an unknown offset
+          make_union(dest, tmp);
         }
       }
     }
@@ -1413,7 +1517,10 @@ void value_sett::do_free(
 
   // mark these as 'may be invalid'
   // this, unfortunately, destroys the sharing
-  for(valuest::iterator v_it=values.begin();
+  typedef std::list<std::pair<idt, object_mapt> > changest;
+  changest changes;
+
+  for(valuest::const_iterator v_it=values.begin();
       v_it!=values.end();
       v_it++)
   {
@@ -1453,8 +1560,14 @@ void value_sett::do_free(
     }
 
     if(changed)
-      v_it->second.object_map=new_object_map;
+      changes.push_back(std::make_pair(v_it->first, new_object_map));
   }
+
+  for(changest::const_iterator
+      c_it=changes.begin();
+      c_it!=changes.end();
+      c_it++)
+    values.write(c_it->first).object_map=c_it->second;
 }
 
 /*******************************************************************\
@@ -9,10 +9,13 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_POINTER_ANALYSIS_VALUE_SET_H
 #define CPROVER_POINTER_ANALYSIS_VALUE_SET_H
 
+#include <algorithm>
 #include <set>
+#include <vector>
 
 #include <util/mp_arith.h>
 #include <util/reference_counting.h>
+#include <util/sharing_map.h>
 
 #include "object_numbering.h"
 #include "value_sets.h"
@@ -55,11 +58,71 @@ public:
     { return offset_is_set && offset.is_zero(); }
   };
 
-  class object_map_dt:public std::map<unsigned, objectt>
+  // The objects by their number, with their offset. The entries are
+  // kept sorted by number in a vector, which is compact, and lets
+  // union merge two maps in linear time.
+  class object_map_dt
   {
   public:
+    typedef std::pair<unsigned, objectt> value_type;
+    typedef std::vector<value_type> datat;
+    typedef datat::const_iterator const_iterator;
+    typedef datat::iterator iterator;
+
     object_map_dt() {}
     static const object_map_dt blank;
+
+    const_iterator begin() const { return data.begin(); }
+    const_iterator end() const { return data.end(); }
+    iterator begin() { return data.begin(); }
+    iterator end() { return data.end(); }
+
+    std::size_t size() const { return data.size(); }
+    bool empty() const { return data.empty(); }
+    void clear() { data.clear(); }
+    void swap(object_map_dt &other) { data.swap(other.data); }
+
+    const_iterator find(unsigned n) const
+    {
+      const_iterator it=lower_bound(n);
+      if(it!=data.end() && it->first==n)
+        return it;
+      return data.end();
+    }
+
+    // adds the object with an unset offset, if need be
+    objectt &operator[](unsigned n)
+    {
+      iterator it=lower_bound(n);
+      if(it==data.end() || it->first!=n)
+        it=data.insert(it, value_type(n, objectt()));
+      return it->second;
+    }
+
+    // whether adding the objects of 'other' would change nothing
+    bool includes(const object_map_dt &other) const;
+
+    // sets this to the union of 'a' and 'b', where objects with
+    // different offsets get an unset offset
+    void make_union(const object_map_dt &a, const object_map_dt &b);
+
+  protected:
+    datat data;
+
+    const_iterator lower_bound(unsigned n) const
+    {
+      return std::lower_bound(data.begin(), data.end(), n, number_less);
+    }
+
+    iterator lower_bound(unsigned n)
+    {
+      return std::lower_bound(data.begin(), data.end(), n, number_less);
+    }
+
+    static bool number_less(const value_type &entry, unsigned n)
+    {
+      return entry.first<n;
+    }
   };
 
   exprt to_expr(object_map_dt::const_iterator it) const;
@@ -115,11 +178,10 @@ public:
 
   typedef std::set<exprt> expr_sett;
 
-  #ifdef USE_DSTRING
-  typedef std::map<idt, entryt> valuest;
-  #else
-  typedef std::unordered_map<idt, entryt, string_hash> valuest;
-  #endif
+  // hashed by the number of the identifier, not ordered; output
+  // that needs an order has to sort. Copies of value sets share
+  // the entries that neither changes.
+  typedef sharing_mapt<idt, entryt, irep_id_hash> valuest;
 
   void get_value_set(
     const exprt &expr,
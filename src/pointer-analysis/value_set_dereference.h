@@ -75,6 +75,9 @@ public:
 
   typedef std::unordered_set<exprt, irep_hash> expr_sett;
 
+  // numbers the invalid objects, shared by all instances
+  static unsigned invalid_counter;
+
 private:
   const namespacet &ns;
   symbol_tablet &new_symbol_table;
@@ -83,7 +86,6 @@ private:
   /// language_mode: ID_java, ID_C or another language identifier
   /// if we know the source language in use, irep_idt() otherwise.
   const irep_idt language_mode;
-  static unsigned invalid_counter;
 
   bool dereference_type_compare(
     const typet &object_type,
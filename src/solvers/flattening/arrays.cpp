@@ -67,6 +67,40 @@ void arrayst::record_array_index(const index_exprt &index)
 
 /*******************************************************************\
 
+Function: arrayst::record_array_indices
+
+  Inputs: an expression that hasn't been converted
+
+ Outputs:
+
+ Purpose: records the indices of the unbounded arrays that converting
+          the expression would record
+
+\*******************************************************************/
+
+void arrayst::record_array_indices(const exprt &expr)
+{
+  if(expr.id()==ID_index)
+  {
+    const index_exprt &index_expr=to_index_expr(expr);
+    const typet &array_type=ns.follow(index_expr.array().type());
+
+    // the conversion of these doesn't look at the array
+    if(array_type.id()==ID_array &&
+       is_unbounded_array(array_type))
+    {
+      record_array_index(index_expr);
+      record_array_indices(index_expr.index());
+      return;
+    }
+  }
+
+  forall_operands(it, expr)
+    record_array_indices(*it);
+}
+
+/*******************************************************************\
+
 Function: arrayst::record_array_equality
 
   Inputs:
@@ -307,16 +341,18 @@ void arrayst::add_array_constraint(const lazy_constraintt &lazy, bool refine)
     // lazily add the constraint
     if(incremental_cache)
     {
-      if(expr_map.find(lazy.lazy) == expr_map.end())
-      {
-        lazy_array_constraints.push_back(lazy);
-        expr_map[lazy.lazy] = true;
-      }
-    }
-    else
-    {
-      lazy_array_constraints.push_back(lazy);
+      if(expr_map.find(lazy.lazy)!=expr_map.end())
+        return;
+
+      expr_map[lazy.lazy] = true;
     }
+
+    // The constraint is only converted once a model violates it,
+    // but the indices it uses are recorded now, as the conversion
+    // would when adding the constraint eagerly.
+    record_array_indices(lazy.lazy);
+
+    lazy_array_constraints.push_back(lazy);
   }
   else
   {
@@ -558,16 +594,19 @@ void arrayst::add_array_constraints(
 
     assert(index_expr1.type()==index_expr2.type());
 
-    array_equalityt equal;
-    equal.f1 = index_expr1;
-    equal.f2 = index_expr2;
-    equal.l = array_equality.l;
     equal_exprt equality_expr(index_expr1, index_expr2);
 
     // add constraint
-    // equality constraints are not added lazily
-    // convert must be done to guarantee correct update of the index_set
-    prop.lcnf(!array_equality.l, convert(equality_expr));
+    // convert must be done to guarantee correct update of the index_set,
+    // which add_array_constraint records when adding it lazily
+    if(lazy_arrays)
+    {
+      lazy_constraintt lazy(ARRAY_EQUALITY,
+        or_exprt(literal_exprt(!array_equality.l), equality_expr));
+      add_array_constraint(lazy, true); // added lazily
+    }
+    else
+      prop.lcnf(!array_equality.l, convert(equality_expr));
   }
 }
 
@@ -726,7 +765,7 @@ void arrayst::add_array_constraints_with(
         // add constraint
         lazy_constraintt lazy(ARRAY_WITH, or_exprt(equality_expr,
                                 literal_exprt(guard_lit)));
-        add_array_constraint(lazy, false); // added immediately
+        add_array_constraint(lazy, true); // added lazily
 
 #if 0 // old code for adding, not significantly faster
         {
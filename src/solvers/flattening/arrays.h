@@ -38,6 +38,7 @@ public:
 
   literalt record_array_equality(const equal_exprt &expr);
   void record_array_index(const index_exprt &expr);
+  void record_array_indices(const exprt &expr);
 
 protected:
   virtual void post_process_arrays()
@@ -74,7 +75,8 @@ protected:
     ARRAY_WITH,
     ARRAY_IF,
     ARRAY_OF,
-    ARRAY_TYPECAST
+    ARRAY_TYPECAST,
+    ARRAY_EQUALITY
   } lazy_typet;
   struct lazy_constraintt
   {
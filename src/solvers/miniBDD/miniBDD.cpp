@@ -218,6 +218,18 @@ mini_bddt mini_bdd_applyt::APP(const mini_bddt &x, const mini_bddt &y)
 
   if(x.is_constant() && y.is_constant())
     u=mini_bddt(fkt(x.is_true(), y.is_true())?mgr->True():mgr->False());
+  else if(x.is_constant() &&
+          fkt(x.is_true(), false)==fkt(x.is_true(), true))
+    u=mini_bddt(fkt(x.is_true(), false)?mgr->True():mgr->False());
+  else if(x.is_constant() &&
+          !fkt(x.is_true(), false) && fkt(x.is_true(), true))
+    u=y; // e.g., true&y, false|y
+  else if(y.is_constant() &&
+          fkt(false, y.is_true())==fkt(true, y.is_true()))
+    u=mini_bddt(fkt(false, y.is_true())?mgr->True():mgr->False());
+  else if(y.is_constant() &&
+          !fkt(false, y.is_true()) && fkt(true, y.is_true()))
+    u=x;
   else if(x.var()==y.var())
     u=mgr->mk(x.var(),
               APP(x.low(), y.low()),
@@ -338,10 +350,10 @@ mini_bddt mini_bdd_mgrt::mk(
 bool mini_bdd_mgrt::reverse_keyt::operator<(
   const mini_bdd_mgrt::reverse_keyt &other) const
 {
-  if(var<other.var || low<other.low)
-    return true;
-  if(var>other.var || low>other.low)
-    return false;
+  if(var!=other.var)
+    return var<other.var;
+  if(low!=other.low)
+    return low<other.low;
 
   return high<other.high;
 }
@@ -6,6 +6,8 @@ Author: Daniel Kroening, kroening@kroening.com
 
 \*******************************************************************/
 
+#include <algorithm>
+#include <functional>
 #include <set>
 #include <stack>
 
@@ -33,14 +35,58 @@ Function: aig_prop_baset::land
 
 literalt aig_prop_baset::land(const bvt &bv)
 {
-  literalt literal=const_literal(true);
+  bvt inputs;
+  inputs.reserve(bv.size());
+
+  forall_literals(it, bv)
+  {
+    if(it->is_false())
+      return const_literal(false);
+    if(!it->is_true())
+      inputs.push_back(*it);
+  }
+
+  // Sorting makes conjunctions over the same literals share
+  // their nodes. A literal and its negation become neighbours.
+  std::sort(inputs.begin(), inputs.end());
+  inputs.erase(std::unique(inputs.begin(), inputs.end()), inputs.end());
+
+  for(std::size_t i=1; i<inputs.size(); i++)
+    if(inputs[i]==neg(inputs[i-1]))
+      return const_literal(false);
+
+  if(inputs.empty())
+    return const_literal(true);
 
   // Introduces N-1 extra nodes for N bits
   // See convert_node for where this overhead is removed
-  forall_literals(it, bv)
-    literal=land(*it, literal);
+  return balanced_and(inputs.begin(), inputs.end());
+}
 
-  return literal;
+/*******************************************************************\
+
+Function: aig_prop_baset::balanced_and
+
+  Inputs: non-empty range of literals
+
+ Outputs:
+
+ Purpose: conjunction as a tree of minimal depth
+
+\*******************************************************************/
+
+literalt aig_prop_baset::balanced_and(
+  bvt::const_iterator begin,
+  bvt::const_iterator end)
+{
+  assert(begin!=end);
+
+  if(end-begin==1)
+    return *begin;
+
+  bvt::const_iterator middle=begin+(end-begin)/2;
+
+  return land(balanced_and(begin, middle), balanced_and(middle, end));
 }
 
 /*******************************************************************\
@@ -57,14 +103,13 @@ Function: aig_prop_baset::lor
 
 literalt aig_prop_baset::lor(const bvt &bv)
 {
-  literalt literal=const_literal(true);
+  bvt inputs;
+  inputs.reserve(bv.size());
 
-  // Introduces N-1 extra nodes for N bits
-  // See convert_node for where this overhead is removed
   forall_literals(it, bv)
-    literal=land(neg(*it), literal);
+    inputs.push_back(neg(*it));
 
-  return neg(literal);
+  return neg(land(inputs));
 }
 
 /*******************************************************************\
@@ -113,7 +158,135 @@ literalt aig_prop_baset::land(literalt a, literalt b)
   if(a==b)
     return a;
 
-  return dest.new_and_node(a, b);
+  return rewrite_and(a, b);
+}
+
+/*******************************************************************\
+
+Function: aig_prop_baset::rewrite_and
+
+  Inputs: two non-constant literals over different nodes
+
+ Outputs:
+
+ Purpose: Simplifies a conjunction by looking at the nodes of the
+          inputs, using the rules of Brummayer and Biere, "Local
+          Two-Level And-Inverter Graph Minimization without Blowup".
+          None of the rules adds more nodes than it saves.
+
+\*******************************************************************/
+
+literalt aig_prop_baset::rewrite_and(literalt a, literalt b)
+{
+  // one input is a node, (x&y)&b or !(x&y)&b
+  for(unsigned i=0; i<2; i++, std::swap(a, b))
+  {
+    if(!is_and_node(a))
+      continue;
+
+    literalt x=dest.get_node(a).a;
+    literalt y=dest.get_node(a).b;
+
+    if(!a.sign())
+    {
+      if(b==neg(x) || b==neg(y)) // contradiction
+        return const_literal(false);
+
+      if(b==x || b==y) // idempotence
+        return a;
+    }
+    else
+    {
+      if(b==neg(x) || b==neg(y)) // subsumption
+        return b;
+
+      if(b==x) // substitution
+        return land(b, neg(y));
+
+      if(b==y)
+        return land(b, neg(x));
+    }
+  }
+
+  // both inputs are nodes
+  if(is_and_node(a) && is_and_node(b))
+  {
+    if(!a.sign() && b.sign())
+      std::swap(a, b);
+
+    literalt x=dest.get_node(a).a;
+    literalt y=dest.get_node(a).b;
+    literalt u=dest.get_node(b).a;
+    literalt v=dest.get_node(b).b;
+
+    if(!a.sign() && !b.sign())
+    {
+      // (x&y)&(u&v)
+      if(x==neg(u) || x==neg(v) || y==neg(u) || y==neg(v)) // contradiction
+        return const_literal(false);
+
+      if(x==u || y==u) // idempotence
+        return land(a, v);
+
+      if(x==v || y==v)
+        return land(a, u);
+    }
+    else if(a.sign() && !b.sign())
+    {
+      // !(x&y)&(u&v)
+      if(x==neg(u) || x==neg(v) || y==neg(u) || y==neg(v)) // subsumption
+        return b;
+
+      if(x==u || x==v) // substitution
+        return land(neg(y), b);
+
+      if(y==u || y==v)
+        return land(neg(x), b);
+    }
+    else
+    {
+      // !(x&y)&!(u&v)
+      if((x==u && y==neg(v)) || (x==v && y==neg(u))) // resolution
+        return neg(x);
+
+      if((y==u && x==neg(v)) || (y==v && x==neg(u)))
+        return neg(y);
+    }
+  }
+
+  return hashed_and_node(a, b);
+}
+
+/*******************************************************************\
+
+Function: aig_prop_baset::hashed_and_node
+
+  Inputs: two literals
+
+ Outputs: literal of an AND node
+
+ Purpose: returns the existing node for the inputs, if any,
+          and a new one otherwise
+
+\*******************************************************************/
+
+literalt aig_prop_baset::hashed_and_node(literalt a, literalt b)
+{
+  // the key does not depend on the order of the inputs,
+  // but the node keeps it
+  literalt first=a<b?a:b;
+  literalt second=a<b?b:a;
+
+  unsigned long long key=
+    (static_cast<unsigned long long>(first.get())<<32) | second.get();
+
+  std::pair<strasht::iterator, bool> entry=
+    strash.insert(std::make_pair(key, literalt()));
+
+  if(entry.second)
+    entry.first->second=dest.new_and_node(a, b);
+
+  return entry.first->second;
 }
 
 /*******************************************************************\
@@ -302,7 +475,158 @@ Function: aig_prop_solvert::l_get
 
 tvt aig_prop_solvert::l_get(literalt a) const
 {
-  return solver.l_get(a);
+  if(a.is_constant())
+    return tvt(a.is_true());
+
+  literalt::var_not v=a.var_no();
+
+  if(v>=aig.nodes.size())
+    return tvt::unknown();
+
+  tvt result=node_value(v);
+  return a.sign()?!result:result;
+}
+
+/*******************************************************************\
+
+Function: aig_prop_solvert::node_value
+
+  Inputs: a node
+
+ Outputs: its value in the current model
+
+ Purpose: The variable of an AND node may be constrained in one phase
+          only, and then doesn't necessarily have the value of the
+          node in a model. The values of AND nodes are thus computed
+          from the values of the inputs.
+
+\*******************************************************************/
+
+tvt aig_prop_solvert::node_value(unsigned n) const
+{
+  if(n<has_node_value.size() && has_node_value[n])
+    return node_values[n];
+
+  if(has_node_value.size()<aig.nodes.size())
+  {
+    has_node_value.resize(aig.nodes.size(), false);
+    node_values.resize(aig.nodes.size(), tvt::unknown());
+  }
+
+  // the AIG may be deep, hence no recursion
+  std::stack<unsigned> stack;
+  stack.push(n);
+
+  while(!stack.empty())
+  {
+    unsigned m=stack.top();
+
+    if(has_node_value[m])
+    {
+      stack.pop();
+      continue;
+    }
+
+    const aigt::nodet &node=aig.nodes[m];
+
+    if(!node.is_and())
+    {
+      if(m<var_map.size() &&
+         var_map[m].var_no()!=literalt::unused_var_no())
+        node_values[m]=solver.l_get(var_map[m]);
+      else
+        node_values[m]=tvt::unknown(); // in no clause
+
+      has_node_value[m]=true;
+      stack.pop();
+      continue;
+    }
+
+    bool inputs_done=true;
+
+    if(!node.a.is_constant() && !has_node_value[node.a.var_no()])
+    {
+      stack.push(node.a.var_no());
+      inputs_done=false;
+    }
+
+    if(!node.b.is_constant() && !has_node_value[node.b.var_no()])
+    {
+      stack.push(node.b.var_no());
+      inputs_done=false;
+    }
+
+    if(inputs_done)
+    {
+      tvt a=node.a.is_constant()?
+        tvt(node.a.is_true()):node_values[node.a.var_no()];
+      tvt b=node.b.is_constant()?
+        tvt(node.b.is_true()):node_values[node.b.var_no()];
+
+      if(node.a.sign() && !node.a.is_constant())
+        a=!a;
+      if(node.b.sign() && !node.b.is_constant())
+        b=!b;
+
+      node_values[m]=a && b;
+      has_node_value[m]=true;
+      stack.pop();
+    }
+  }
+
+  return node_values[n];
+}
+
+/*******************************************************************\
+
+Function: aig_prop_solvert::solver_literal
+
+  Inputs: literal of the AIG
+
+ Outputs: literal of the solver
+
+ Purpose: Nodes get a solver variable when they are first used
+          in a clause, which leaves out the inlined ones.
+
+\*******************************************************************/
+
+literalt aig_prop_solvert::solver_literal(literalt a)
+{
+  if(a.is_constant())
+    return a;
+
+  literalt::var_not v=a.var_no();
+
+  if(v>=var_map.size())
+    var_map.resize(aig.nodes.size());
+
+  if(var_map[v].var_no()==literalt::unused_var_no())
+    var_map[v]=solver.new_variable();
+
+  return var_map[v]^a.sign();
+}
+
+/*******************************************************************\
+
+Function: aig_prop_solvert::add_clause
+
+  Inputs: clause over literals of the AIG
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void aig_prop_solvert::add_clause(const bvt &clause)
+{
+  bvt lits;
+  lits.reserve(clause.size());
+
+  forall_literals(it, clause)
+    lits.push_back(solver_literal(*it));
+
+  solver.lcnf(lits);
 }
 
 /*******************************************************************\
@@ -320,9 +644,24 @@ Function: aig_prop_solvert::prop_solve
 propt::resultt aig_prop_solvert::prop_solve()
 {
   status() << "converting AIG, "
-           << aig.nodes.size() << " nodes" << eom;
+           << aig.nodes.size() << " nodes, "
+           << strash.size() << " distinct AND nodes" << eom;
   convert_aig();
 
+  // the values of the last model are no longer valid
+  has_node_value.clear();
+  node_values.clear();
+
+  if(solver.has_set_assumptions())
+  {
+    bvt solver_assumptions;
+
+    forall_literals(it, assumptions)
+      solver_assumptions.push_back(solver_literal(*it));
+
+    solver.set_assumptions(solver_assumptions);
+  }
+
   return solver.prop_solve();
 }
 
@@ -330,26 +669,24 @@ propt::resultt aig_prop_solvert::prop_solve()
 
 Function: aig_prop_solvert::compute_phase
 
-  Inputs: Two vectors of bools of size aig.nodes.size()
+  Inputs: The literals that need to hold
 
- Outputs: These vectors filled in with per node phase information
+ Outputs: n_pos and n_neg set for the phases not encoded yet, and
+          the nodes that got one of them
 
  Purpose: Compute the phase information needed for Plaisted-Greenbaum encoding
 
 \*******************************************************************/
 
 void aig_prop_solvert::compute_phase(
-  std::vector<bool> &n_pos,
-  std::vector<bool> &n_neg)
+  const bvt &roots,
+  std::vector<unsigned> &nodes)
 {
   std::stack<literalt> queue;
 
   // Get phases of constraints
-  for(aig_plus_constraintst::constraintst::const_iterator
-      c_it=aig.constraints.begin();
-      c_it!=aig.constraints.end();
-      c_it++)
-    queue.push(*c_it);
+  forall_literals(it, roots)
+    queue.push(*it);
 
   while(!queue.empty())
   {
@@ -363,9 +700,13 @@ void aig_prop_solvert::compute_phase(
     unsigned var_no=l.var_no();
 
     // already set?
-    if(sign?n_neg[var_no]:n_pos[var_no])
+    if(sign?(n_neg[var_no] || encoded_neg[var_no]):
+            (n_pos[var_no] || encoded_pos[var_no]))
       continue; // done already
 
+    if(!n_pos[var_no] && !n_neg[var_no])
+      nodes.push_back(var_no);
+
     // set
     sign?n_neg[var_no]=1:n_pos[var_no]=1;
 
@@ -381,7 +722,7 @@ void aig_prop_solvert::compute_phase(
   // Count
   unsigned pos_only=0, neg_only=0, mixed=0;
 
-  for(unsigned n=0; n<aig.nodes.size(); n++)
+  for(const auto n : nodes)
   {
     if(aig.nodes[n].is_and())
     {
@@ -404,25 +745,26 @@ void aig_prop_solvert::compute_phase(
 
 Function: aig_prop_solvert::usage_count
 
-  Inputs: Two vectors of unsigned of size aig.nodes.size()
+  Inputs: The literals that need to hold, and the nodes to encode
 
- Outputs: These vectors filled in with per node usage information
+ Outputs: p_usage_count and n_usage_count filled in for these, and
+          the nodes whose counts were changed
 
  Purpose: Compact encoding for single usage variable
 
 \*******************************************************************/
 
 void aig_prop_solvert::usage_count(
-  std::vector<unsigned> &p_usage_count,
-  std::vector<unsigned> &n_usage_count)
+  const bvt &roots,
+  const std::vector<unsigned> &nodes,
+  std::vector<unsigned> &counted)
 {
-  for(aig_plus_constraintst::constraintst::const_iterator
-      c_it=aig.constraints.begin();
-      c_it!=aig.constraints.end();
-      c_it++)
+  for(bvt::const_iterator c_it=roots.begin(); c_it!=roots.end(); c_it++)
   {
     if(!((*c_it).is_constant()))
     {
+      counted.push_back((*c_it).var_no());
+
       if((*c_it).sign())
       {
         ++n_usage_count[(*c_it).var_no()];
@@ -434,12 +776,15 @@ void aig_prop_solvert::usage_count(
     }
   }
 
-  for(unsigned n=0; n<aig.nodes.size(); n++)
+  for(const auto n : nodes)
   {
     const aigt::nodet &node=aig.nodes[n];
 
     if(node.is_and())
     {
+      counted.push_back(node.a.var_no());
+      counted.push_back(node.b.var_no());
+
       if(node.a.sign())
       {
         ++n_usage_count[node.a.var_no()];
@@ -462,7 +807,7 @@ void aig_prop_solvert::usage_count(
 
 
   #if 1
-  // Compute stats
+  // Compute stats, over the nodes to encode
   unsigned unused=0;
   unsigned usedOncePositive=0;
   unsigned usedOnceNegative=0;
@@ -472,7 +817,7 @@ void aig_prop_solvert::usage_count(
   unsigned usedThreeTimes=0;
   unsigned usedMore=0;
 
-  for(unsigned n=0; n<aig.nodes.size(); n++)
+  for(const auto n : nodes)
   {
     switch(p_usage_count[n] + n_usage_count[n])
     {
@@ -555,8 +900,9 @@ void aig_prop_solvert::convert_node(
 
       if(!l.sign() &&                      // Used positively...
          aig.nodes[l.var_no()].is_and() && // ... is a gate ...
-         p_usage_count[l.var_no()] == 1 && // ... only used here.
-         n_usage_count[l.var_no()] == 0)
+         p_usage_count[l.var_no()] == 1 && // ... only used here ...
+         n_usage_count[l.var_no()] == 0 &&
+         !encoded_pos[l.var_no()])         // ... and not encoded yet.
       {
         const aigt::nodet &rep=aig.nodes[l.var_no()];
         body[i]=rep.a;
@@ -590,49 +936,84 @@ void aig_prop_solvert::convert_node(
       const aigt::nodet &left=aig.nodes[body[0].var_no()];
       const aigt::nodet &right=aig.nodes[body[1].var_no()];
 
-      if(left.is_and() && right.is_and())
-      {
-        if(left.a==neg(right.a))
-        {
-          if(p_usage_count[body[0].var_no()]==0 &&
-             n_usage_count[body[0].var_no()]==1 &&
-             p_usage_count[body[1].var_no()]==0 &&
-             n_usage_count[body[1].var_no()]==1)
-          {
-            bvt lits(3);
+      // The inputs of the nodes may come in either order;
+      // find s, l, r such that left=s&l and right=!s&r.
+      literalt s, l, r;
+      bool is_mux=true;
 
-            if(n_neg)
-            {
-              lits[0]=left.a;
-              lits[1]=right.b;
-              lits[2]=o;
-              solver.lcnf(lits);
+      if(!left.is_and() || !right.is_and())
+        is_mux=false;
+      else if(left.a==neg(right.a))
+      {
+        s=left.a;
+        l=left.b;
+        r=right.b;
+      }
+      else if(left.a==neg(right.b))
+      {
+        s=left.a;
+        l=left.b;
+        r=right.a;
+      }
+      else if(left.b==neg(right.a))
+      {
+        s=left.b;
+        l=left.a;
+        r=right.b;
+      }
+      else if(left.b==neg(right.b))
+      {
+        s=left.b;
+        l=left.a;
+        r=right.a;
+      }
+      else
+        is_mux=false;
 
-              lits[0]=neg(left.a);
-              lits[1]=left.b;
-              lits[2]=o;
-              solver.lcnf(lits);
-            }
+      if(is_mux)
+      {
+        // Nodes encoded by an earlier call have their inputs
+        // encoded only as far as needed by themselves.
+        if(p_usage_count[body[0].var_no()]==0 &&
+           n_usage_count[body[0].var_no()]==1 &&
+           p_usage_count[body[1].var_no()]==0 &&
+           n_usage_count[body[1].var_no()]==1 &&
+           !encoded_neg[body[0].var_no()] &&
+           !encoded_neg[body[1].var_no()])
+        {
+          bvt lits(3);
 
-            if(n_pos)
-            {
-              lits[0]=left.a;
-              lits[1]=neg(right.b);
-              lits[2]=neg(o);
-              solver.lcnf(lits);
+          if(n_neg)
+          {
+            lits[0]=s;
+            lits[1]=r;
+            lits[2]=o;
+            add_clause(lits);
+
+            lits[0]=neg(s);
+            lits[1]=l;
+            lits[2]=o;
+            add_clause(lits);
+          }
 
-              lits[0]=neg(left.a);
-              lits[1]=neg(left.b);
-              lits[2]=neg(o);
-              solver.lcnf(lits);
-            }
+          if(n_pos)
+          {
+            lits[0]=s;
+            lits[1]=neg(r);
+            lits[2]=neg(o);
+            add_clause(lits);
+
+            lits[0]=neg(s);
+            lits[1]=neg(l);
+            lits[2]=neg(o);
+            add_clause(lits);
+          }
 
-            // Supress generation
-            --n_usage_count[body[0].var_no()];
-            --n_usage_count[body[1].var_no()];
+          // Supress generation
+          --n_usage_count[body[0].var_no()];
+          --n_usage_count[body[1].var_no()];
 
-            return;
-          }
+          return;
         }
       }
     }
@@ -653,13 +1034,35 @@ void aig_prop_solvert::convert_node(
            p_usage_count[body[1].var_no()]==0 &&
            n_usage_count[body[1].var_no()]==1 &&
            p_usage_count[body[2].var_no()]==0 &&
-           n_usage_count[body[2].var_no()]==1)
+           n_usage_count[body[2].var_no()]==1 &&
+           !encoded_neg[body[0].var_no()] &&
+           !encoded_neg[body[1].var_no()] &&
+           !encoded_neg[body[2].var_no()])
         {
+          // left=a&b, and mid and right are a&c and b&c,
+          // with the inputs of the nodes in any order
           literalt a=left.a;
           literalt b=left.b;
-          literalt c=mid.a;
+          literalt c, other;
+          bool is_carry=true;
+
+          if(mid.a==a || mid.a==b)
+          {
+            c=mid.b;
+            other=mid.a==a?b:a;
+          }
+          else if(mid.b==a || mid.b==b)
+          {
+            c=mid.a;
+            other=mid.b==a?b:a;
+          }
+          else
+            is_carry=false;
 
-          if(a==right.b && b==mid.b && c==right.a)
+          if(is_carry &&
+             a!=b && c!=a && c!=b &&
+             ((right.a==other && right.b==c) ||
+              (right.a==c && right.b==other)))
           {
             // A (negative) carry -- 1 if at most one input is 1
             bvt lits(3);
@@ -669,17 +1072,17 @@ void aig_prop_solvert::convert_node(
               lits[0]=a;
               lits[1]=b;
               lits[2]=o;
-              solver.lcnf(lits);
+              add_clause(lits);
 
               lits[0]=a;
               lits[1]=c;
               lits[2]=o;
-              solver.lcnf(lits);
+              add_clause(lits);
 
               lits[0]=b;
               lits[1]=c;
               lits[2]=o;
-              solver.lcnf(lits);
+              add_clause(lits);
             }
 
             if(n_pos)
@@ -687,17 +1090,17 @@ void aig_prop_solvert::convert_node(
               lits[0]=neg(a);
               lits[1]=neg(b);
               lits[2]=neg(o);
-              solver.lcnf(lits);
+              add_clause(lits);
 
               lits[0]=neg(a);
               lits[1]=neg(c);
               lits[2]=neg(o);
-              solver.lcnf(lits);
+              add_clause(lits);
 
               lits[0]=neg(b);
               lits[1]=neg(c);
               lits[2]=neg(o);
-              solver.lcnf(lits);
+              add_clause(lits);
             }
 
             // Supress generation
@@ -725,7 +1128,7 @@ void aig_prop_solvert::convert_node(
       forall_literals(it, body)
       {
         lits[0]=pos(*it);
-        solver.lcnf(lits);
+        add_clause(lits);
       }
     }
 
@@ -737,7 +1140,7 @@ void aig_prop_solvert::convert_node(
         lits.push_back(neg(*it));
 
       lits.push_back(pos(o));
-      solver.lcnf(lits);
+      add_clause(lits);
     }
   }
 }
@@ -750,55 +1153,70 @@ Function: aig_prop_solvert::convert_aig
 
  Outputs:
 
- Purpose:
+ Purpose: Encode the constraints added since the last call, and
+          the phases of the nodes they need that are not encoded
+          yet; only these nodes are looked at.
 
 \*******************************************************************/
 
 void aig_prop_solvert::convert_aig()
 {
-  // 1. Do variables
-  while(solver.no_variables()<=aig.nodes.size())
-    solver.new_variable();
-
-  // Usage count for inlining
-
-  std::vector<unsigned> p_usage_count;
-  std::vector<unsigned> n_usage_count;
+  encoded_pos.resize(aig.nodes.size(), false);
+  encoded_neg.resize(aig.nodes.size(), false);
+  n_pos.resize(aig.nodes.size(), false);
+  n_neg.resize(aig.nodes.size(), false);
   p_usage_count.resize(aig.nodes.size(), 0);
   n_usage_count.resize(aig.nodes.size(), 0);
 
-  this->usage_count(p_usage_count, n_usage_count);
-
+  // what needs to hold: the new constraints and the assumptions
+  bvt roots(
+    aig.constraints.begin()+converted_constraints,
+    aig.constraints.end());
+  roots.insert(roots.end(), assumptions.begin(), assumptions.end());
 
-  #ifdef USE_PG
   // Get phases
-  std::vector<bool> n_pos, n_neg;
-  n_pos.resize(aig.nodes.size(), false);
-  n_neg.resize(aig.nodes.size(), false);
+  std::vector<unsigned> nodes;
+  this->compute_phase(roots, nodes);
 
-  this->compute_phase(n_pos, n_neg);
+  #ifndef USE_PG
+  for(const auto n : nodes)
+    n_pos[n]=n_neg[n]=true;
   #endif
 
-  // 2. Do nodes
-  for(std::size_t n=aig.nodes.size() - 1; n!=0; n--)
+  // Usage count for inlining
+  std::vector<unsigned> counted;
+  this->usage_count(roots, nodes, counted);
+
+  // 1. Do nodes, from the outputs to the inputs
+  std::sort(nodes.begin(), nodes.end(), std::greater<unsigned>());
+
+  for(const auto n : nodes)
   {
-    if(aig.nodes[n].is_and())
+    // Nodes that have been inlined are not encoded, and may
+    // need to be encoded later on.
+    if(aig.nodes[n].is_and() &&
+       (p_usage_count[n]>0 || n_usage_count[n]>0))
     {
-#ifdef USE_PG
       convert_node(
         n, aig.nodes[n], n_pos[n], n_neg[n], p_usage_count, n_usage_count);
-#else
-      convert_node(n, aig.nodes[n], true, true, p_usage_count, n_usage_count);
-#endif
+
+      if(n_pos[n])
+        encoded_pos[n]=true;
+      if(n_neg[n])
+        encoded_neg[n]=true;
     }
   }
-  // Skip zero as it is not used or a valid literal
 
+  // 2. Do constraints
+  for(std::size_t i=converted_constraints; i<aig.constraints.size(); i++)
+    solver.l_set_to(solver_literal(aig.constraints[i]), true);
+
+  converted_constraints=aig.constraints.size();
 
-  // 3. Do constraints
-  for(const auto &c_it : aig.constraints)
-    solver.l_set_to(c_it, true);
+  // clean up for the next call
+  for(const auto n : nodes)
+    n_pos[n]=n_neg[n]=false;
 
-  // HACK!
-  aig.nodes.clear();
+  for(const auto n : counted)
+    p_usage_count[n]=n_usage_count[n]=0;
 }
@@ -10,6 +10,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #define CPROVER_SOLVERS_PROP_AIG_PROP_H
 
 #include <cassert>
+#include <unordered_map>
 
 #include <util/threeval.h>
 #include <solvers/prop/prop.h>
@@ -61,6 +62,20 @@ public:
 
 protected:
   aigt &dest;
+
+  // structural hashing: the AND node for a pair of inputs,
+  // keyed by both literals, the smaller one first
+  typedef std::unordered_map<unsigned long long, literalt> strasht;
+  strasht strash;
+
+  literalt rewrite_and(literalt a, literalt b);
+  literalt hashed_and_node(literalt a, literalt b);
+  literalt balanced_and(bvt::const_iterator begin, bvt::const_iterator end);
+
+  bool is_and_node(literalt l) const
+  {
+    return !l.is_constant() && dest.get_node(l).is_and();
+  }
 };
 
 class aig_prop_constraintt:public aig_prop_baset
@@ -91,7 +106,8 @@ class aig_prop_solvert:public aig_prop_constraintt
 public:
   explicit aig_prop_solvert(propt &_solver):
     aig_prop_constraintt(aig),
-    solver(_solver)
+    solver(_solver),
+    converted_constraints(0)
   {
   }
 
@@ -107,6 +123,16 @@ public:
   tvt l_get(literalt a) const override;
   resultt prop_solve() override;
 
+  void set_assumptions(const bvt &_assumptions) override
+  {
+    assumptions=_assumptions;
+  }
+
+  bool has_set_assumptions() const override
+  {
+    return solver.has_set_assumptions();
+  }
+
   void set_message_handler(message_handlert &m) override
   {
     aig_prop_constraintt::set_message_handler(m);
@@ -116,10 +142,41 @@ public:
 protected:
   propt &solver;
 
+  bvt assumptions;
+
+  // What has been passed to the solver already: the number of
+  // constraints, and the phases in which the nodes are encoded.
+  // Later calls to prop_solve only encode what is new.
+  std::size_t converted_constraints;
+  std::vector<bool> encoded_pos, encoded_neg;
+
+  // the solver variables of the nodes
+  bvt var_map;
+
+  // The values of the nodes in the current model, computed from
+  // the values of the inputs, as the Plaisted-Greenbaum encoding
+  // constrains the variables of the AND nodes in one phase only.
+  mutable std::vector<tvt> node_values;
+  mutable std::vector<bool> has_node_value;
+  tvt node_value(unsigned n) const;
+
+  literalt solver_literal(literalt a);
+  void add_clause(const bvt &clause);
+
+  // Used by convert_aig, by node, for the nodes it encodes; these
+  // are all reset when it is done, so that the next call only needs
+  // to look at the nodes it encodes.
+  std::vector<bool> n_pos, n_neg;
+  std::vector<unsigned> p_usage_count, n_usage_count;
+
   void convert_aig();
   void usage_count(
-    std::vector<unsigned> &p_usage_count, std::vector<unsigned> &n_usage_count);
-  void compute_phase(std::vector<bool> &n_pos, std::vector<bool> &n_neg);
+    const bvt &roots,
+    const std::vector<unsigned> &nodes,
+    std::vector<unsigned> &counted);
+  void compute_phase(
+    const bvt &roots,
+    std::vector<unsigned> &nodes);
   void convert_node(
     unsigned n,
     const aigt::nodet &node,
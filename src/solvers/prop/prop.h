@@ -107,6 +107,11 @@ public:
   // an incremental solver may remove any variables that aren't frozen
   virtual void set_frozen(literalt a) { }
 
+  // Stops a running prop_solve from another thread, which then
+  // returns P_ERROR. The solver can be used again afterwards.
+  virtual void interrupt() { }
+  virtual bool has_interrupt() const { return false; }
+
 protected:
   // to avoid a temporary for lcnf(...)
   bvt lcnf_bv;
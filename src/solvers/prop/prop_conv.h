@@ -108,6 +108,21 @@ public:
 
   virtual void clear_cache() { cache.clear();}
 
+  // post-processing is done by the first call to dec_solve;
+  // this requests it again, for constraints added since
+  void redo_post_processing() { post_processing_done=false; }
+
+  // does the post-processing without solving, e.g., when the
+  // clauses are to be passed on to other solvers
+  void finish_eager_conversion()
+  {
+    if(!post_processing_done)
+    {
+      post_process();
+      post_processing_done=true;
+    }
+  }
+
   typedef std::map<irep_idt, literalt> symbolst;
   typedef std::unordered_map<exprt, literalt, irep_hash> cachet;
 
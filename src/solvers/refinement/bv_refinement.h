@@ -93,7 +93,13 @@ protected:
   // we refine the theory of arrays
   virtual void post_process_arrays();
   void arrays_overapproximated();
-  void freeze_lazy_constraints();
+  void report_array_refinement();
+  void freeze_converted(const exprt &expr);
+  exprt get_converted(const exprt &expr) const;
+
+  // the number of lazy array constraints, and of those converted
+  std::size_t array_constraints_lazy;
+  std::size_t array_constraints_added;
 
   // we refine expensive arithmetic
   virtual bvt convert_mult(const exprt &expr);
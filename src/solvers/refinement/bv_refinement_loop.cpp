@@ -29,7 +29,9 @@ bv_refinementt::bv_refinementt(
   bv_pointerst(_ns, _prop),
   max_node_refinement(5),
   do_array_refinement(true),
-  do_arithmetic_refinement(true)
+  do_arithmetic_refinement(true),
+  array_constraints_lazy(0),
+  array_constraints_added(0)
 {
   // check features we need
   assert(prop.has_set_assumptions());
@@ -98,6 +100,7 @@ decision_proceduret::resultt bv_refinementt::dec_solve()
       {
         status() << "BV-Refinement: got SAT, and it simulates => SAT" << eom;
         status() << "Total iterations: " << iteration << eom;
+        report_array_refinement();
         return D_SATISFIABLE;
       }
       else
@@ -112,6 +115,7 @@ decision_proceduret::resultt bv_refinementt::dec_solve()
         status() << "BV-Refinement: got UNSAT, and the proof passes => UNSAT"
                  << eom;
         status() << "Total iterations: " << iteration << eom;
+        report_array_refinement();
         return D_UNSATISFIABLE;
       }
       else
@@ -12,10 +12,11 @@ Author: Daniel Kroening, kroening@kroening.com
 #endif
 
 #include <util/std_expr.h>
-#include <util/find_symbols.h>
+#include <util/simplify_expr.h>
+
+#include <solvers/prop/literal_expr.h>
 
 #include "bv_refinement.h"
-#include <solvers/sat/satcheck.h>
 
 /*******************************************************************\
 
@@ -37,85 +38,221 @@ void bv_refinementt::post_process_arrays()
   // just build the data structure
   update_index_map(true);
 
-  // we don't actually add any constraints
+  // the Ackermann, read-over-write and extensionality
+  // constraints are neither converted nor added
   lazy_arrays=do_array_refinement;
   add_array_constraints();
-  freeze_lazy_constraints();
+
+  // the parts of them that have been converted already
+  // have to survive the preprocessing of the SAT solver
+  for(const auto &lazy : lazy_array_constraints)
+    freeze_converted(lazy.lazy);
+
+  array_constraints_lazy=lazy_array_constraints.size();
+  array_constraints_added=0;
 }
 
 /*******************************************************************\
 
-Function: bv_refinementt::arrays_overapproximated
+Function: bv_refinementt::freeze_converted
 
-  Inputs:
+  Inputs: an expression that hasn't been converted
 
  Outputs:
 
- Purpose: check whether counterexample is spurious
+ Purpose: freezes the literals of the largest sub-expressions
+          that have been converted
 
 \*******************************************************************/
 
-void bv_refinementt::arrays_overapproximated()
+void bv_refinementt::freeze_converted(const exprt &expr)
 {
-  if(!do_array_refinement)
+  if(expr.id()==ID_literal)
+  {
+    set_frozen(to_literal_expr(expr).get_literal());
     return;
+  }
 
-  unsigned nb_active=0;
-
-  std::list<lazy_constraintt>::iterator it=lazy_array_constraints.begin();
-  while(it!=lazy_array_constraints.end())
+  if(expr.type().id()==ID_bool)
   {
-    satcheck_no_simplifiert sat_check;
-    bv_pointerst solver(ns, sat_check);
-    solver.unbounded_array=bv_pointerst::U_ALL;
-
-    exprt current=(*it).lazy;
+    if(expr.id()==ID_symbol)
+    {
+      symbolst::const_iterator it=
+        symbols.find(to_symbol_expr(expr).get_identifier());
 
-    // some minor simplifications
-    // check if they are worth having
-    if(current.id()==ID_implies)
+      if(it!=symbols.end())
+      {
+        set_frozen(it->second);
+        return;
+      }
+    }
+    else
     {
-      implies_exprt imp=to_implies_expr(current);
-      assert(imp.operands().size()==2);
-      exprt implies_simplified=get(imp.op0());
-      if(implies_simplified==false_exprt())
+      cachet::const_iterator it=cache.find(expr);
+
+      if(it!=cache.end())
       {
-        ++it;
-        continue;
+        set_frozen(it->second);
+        return;
       }
     }
+  }
+  else
+  {
+    bv_cachet::const_iterator it=bv_cache.find(expr);
 
-    if(current.id()==ID_or)
+    if(it!=bv_cache.end())
     {
-      or_exprt orexp=to_or_expr(current);
-      assert(orexp.operands().size()==2);
-      exprt o1=get(orexp.op0());
-      exprt o2=get(orexp.op1());
-      if(o1==true_exprt() || o2 == true_exprt())
+      set_frozen(it->second);
+      return;
+    }
+  }
+
+  forall_operands(it, expr)
+    freeze_converted(*it);
+}
+
+/*******************************************************************\
+
+Function: bv_refinementt::get_converted
+
+  Inputs: an expression that hasn't been converted
+
+ Outputs: its value in the current model, or nil if it depends
+          on a part that hasn't been converted
+
+ Purpose:
+
+\*******************************************************************/
+
+exprt bv_refinementt::get_converted(const exprt &expr) const
+{
+  if(expr.is_constant())
+    return expr;
+
+  if(expr.id()==ID_literal)
+  {
+    tvt value=prop.l_get(to_literal_expr(expr).get_literal());
+
+    if(value.is_true())
+      return true_exprt();
+    else if(value.is_false())
+      return false_exprt();
+    else
+      return nil_exprt();
+  }
+
+  if(expr.type().id()==ID_bool)
+  {
+    tvt value;
+    if(!get_bool(expr, value))
+    {
+      if(value.is_true())
+        return true_exprt();
+      else if(value.is_false())
+        return false_exprt();
+    }
+
+    // one operand may decide these
+    if(expr.id()==ID_or || expr.id()==ID_and)
+    {
+      const bool is_or=expr.id()==ID_or;
+      bool all_known=true;
+
+      forall_operands(it, expr)
       {
-        ++it;
-        continue;
+        exprt op=get_converted(*it);
+
+        if(op.is_true() && is_or)
+          return true_exprt();
+        else if(op.is_false() && !is_or)
+          return false_exprt();
+        else if(!op.is_constant())
+          all_known=false;
       }
+
+      if(!all_known)
+        return nil_exprt();
+      else if(is_or)
+        return false_exprt();
+      else
+        return true_exprt();
     }
+  }
+  else
+  {
+    bv_cachet::const_iterator it=bv_cache.find(expr);
+
+    if(it!=bv_cache.end())
+      return bv_get(it->second, expr.type());
+  }
 
-    exprt simplified=get(current);
-    solver << simplified;
+  if(!expr.has_operands())
+    return nil_exprt();
 
-    switch(sat_check.prop_solve())
-    {
-    case decision_proceduret::D_SATISFIABLE:
+  exprt tmp=expr;
+
+  Forall_operands(it, tmp)
+  {
+    exprt op=get_converted(*it);
+
+    if(op.is_nil())
+      return nil_exprt();
+
+    it->swap(op);
+  }
+
+  simplify(tmp, ns);
+
+  if(!tmp.is_constant())
+    return nil_exprt();
+
+  return tmp;
+}
+
+/*******************************************************************\
+
+Function: bv_refinementt::arrays_overapproximated
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: check whether counterexample is spurious, and add the
+          array constraints it violates
+
+\*******************************************************************/
+
+void bv_refinementt::arrays_overapproximated()
+{
+  if(!do_array_refinement)
+    return;
+
+  std::size_t nb_active=0;
+
+  std::list<lazy_constraintt>::iterator it=lazy_array_constraints.begin();
+  while(it!=lazy_array_constraints.end())
+  {
+    // The constraint is converted unless the parts of it that
+    // have been converted already show that the model satisfies
+    // it. The new literals may appear in the constraints that
+    // are converted later, and thus mustn't be eliminated.
+    if(get_converted(it->lazy).is_true())
       ++it;
-      break;
-    case decision_proceduret::D_UNSATISFIABLE:
-      prop.l_set_to_true(convert(current));
+    else
+    {
+      bool old_freeze_all=freeze_all;
+      freeze_all=true;
+      prop.l_set_to_true(convert(it->lazy));
+      freeze_all=old_freeze_all;
+
       nb_active++;
       lazy_array_constraints.erase(it++);
-      break;
-    default:
-      assert(false);
     }
   }
 
+  array_constraints_added+=nb_active;
+
   debug() << "BV-Refinement: " << nb_active
           << " array expressions become active" << eom;
   debug() << "BV-Refinement: " << lazy_array_constraints.size()
@@ -124,37 +261,27 @@ void bv_refinementt::arrays_overapproximated()
     progress=true;
 }
 
-
 /*******************************************************************\
 
-Function: bv_refinementt::freeze_lazy_constraints
+Function: bv_refinementt::report_array_refinement
 
   Inputs:
 
  Outputs:
 
- Purpose: freeze symbols for incremental solving
+ Purpose: report how many of the lazy array constraints had to
+          be converted
 
 \*******************************************************************/
 
-void bv_refinementt::freeze_lazy_constraints()
+void bv_refinementt::report_array_refinement()
 {
-  if(!lazy_arrays)
+  if(!do_array_refinement)
     return;
 
-  for(std::list<lazy_constraintt>::iterator
-        l_it=lazy_array_constraints.begin();
-      l_it!=lazy_array_constraints.end(); ++l_it)
-  {
-    std::set<symbol_exprt> symbols;
-    find_symbols(l_it->lazy, symbols);
-    for(std::set<symbol_exprt>::const_iterator it=symbols.begin();
-        it!=symbols.end(); ++it)
-    {
-      bvt bv=convert_bv(l_it->lazy);
-      forall_literals(b_it, bv)
-        if(!b_it->is_constant())
-          prop.set_frozen(*b_it);
-    }
-  }
+  statistics() << "BV-Refinement: " << array_constraints_added
+               << " of " << array_constraints_lazy
+               << " array constraints converted, "
+               << array_constraints_lazy-array_constraints_added
+               << " never needed" << eom;
 }
@@ -245,7 +245,12 @@ propt::resultt satcheck_glucose_baset<T>::prop_solve()
       Glucose::vec<Glucose::Lit> solver_assumptions;
       convert(assumptions, solver_assumptions);
 
-      if(solver->solve(solver_assumptions))
+      using Glucose::lbool;
+
+      solver->clearInterrupt();
+      lbool solver_result=solver->solveLimited(solver_assumptions);
+
+      if(solver_result==l_True)
       {
         messaget::status() <<
           "SAT checker: instance is SATISFIABLE" << eom;
@@ -253,6 +258,13 @@ propt::resultt satcheck_glucose_baset<T>::prop_solve()
         status=SAT;
         return P_SATISFIABLE;
       }
+      else if(solver_result==l_Undef)
+      {
+        messaget::status() <<
+          "SAT checker was interrupted" << eom;
+        status=INIT;
+        return P_ERROR;
+      }
       else
       {
         messaget::status() <<
@@ -359,6 +371,24 @@ bool satcheck_glucose_baset<T>::is_in_conflict(literalt a) const
 
 /*******************************************************************\
 
+Function: satcheck_glucose_baset::interrupt
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+template<typename T>
+void satcheck_glucose_baset<T>::interrupt()
+{
+  solver->interrupt();
+}
+
+/*******************************************************************\
+
 Function: satcheck_glucose_baset::set_assumptions
 
   Inputs:
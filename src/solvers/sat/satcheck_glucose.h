@@ -45,6 +45,9 @@ public:
   virtual bool has_set_assumptions() const { return true; }
   virtual bool has_is_in_conflict() const { return true; }
 
+  virtual void interrupt();
+  virtual bool has_interrupt() const { return true; }
+
 protected:
   T *solver;
 
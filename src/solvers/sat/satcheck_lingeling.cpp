@@ -127,6 +127,8 @@ propt::resultt satcheck_lingelingt::prop_solve()
   forall_literals(it, assumptions)
     lglassume(solver, it->dimacs());
 
+  interrupted=0;
+
   const int res=lglsat(solver);
   if(res==10)
   {
@@ -135,6 +137,13 @@ propt::resultt satcheck_lingelingt::prop_solve()
     status=SAT;
     return P_SATISFIABLE;
   }
+  else if(res==0)
+  {
+    msg="SAT checker was interrupted";
+    messaget::status() << msg << messaget::eom;
+    status=INIT;
+    return P_ERROR;
+  }
   else
   {
     assert(res==20);
@@ -176,8 +185,10 @@ Function: satcheck_lingelingt::satcheck_lingelingt
 \*******************************************************************/
 
 satcheck_lingelingt::satcheck_lingelingt() :
-  solver(lglinit())
+  solver(lglinit()),
+  interrupted(0)
 {
+  lglseterm(solver, terminate, this);
 }
 
 /*******************************************************************\
@@ -257,3 +268,37 @@ bool satcheck_lingelingt::is_in_conflict(literalt a) const
   assert(!a.is_constant());
   return lglfailed(solver, a.dimacs())!=0;
 }
+
+/*******************************************************************\
+
+Function: satcheck_lingelingt::interrupt
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void satcheck_lingelingt::interrupt()
+{
+  interrupted=1;
+}
+
+/*******************************************************************\
+
+Function: satcheck_lingelingt::terminate
+
+  Inputs: the solver
+
+ Outputs: non-zero if lingeling is to stop
+
+ Purpose:
+
+\*******************************************************************/
+
+int satcheck_lingelingt::terminate(void *state)
+{
+  return static_cast<satcheck_lingelingt *>(state)->interrupted;
+}
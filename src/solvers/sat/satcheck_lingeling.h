@@ -33,10 +33,17 @@ public:
   virtual bool is_in_conflict(literalt a) const;
   virtual void set_frozen(literalt a);
 
+  virtual void interrupt();
+  virtual bool has_interrupt() const { return true; }
+
 protected:
   // NOLINTNEXTLINE(readability/identifiers)
   struct LGL * solver;
   bvt assumptions;
+
+  // polled by lingeling via lglseterm
+  volatile int interrupted;
+  static int terminate(void *);
 };
 
 #endif // CPROVER_SOLVERS_SAT_SATCHECK_LINGELING_H
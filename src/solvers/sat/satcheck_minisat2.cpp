@@ -107,6 +107,28 @@ void satcheck_minisat2_baset<T>::set_polarity(literalt a, bool value)
 
 /*******************************************************************\
 
+Function: satcheck_minisat2_baset::set_random_seed
+
+  Inputs: a positive seed
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+template<typename T>
+void satcheck_minisat2_baset<T>::set_random_seed(double seed)
+{
+  assert(seed>0);
+  assert(solver->nVars()==0);
+  solver->random_seed=seed;
+  solver->rnd_init_act=true;
+  solver->random_var_freq=0.02;
+}
+
+/*******************************************************************\
+
 Function: satcheck_minisat_no_simplifiert::solver_text
 
   Inputs:
@@ -246,7 +268,12 @@ propt::resultt satcheck_minisat2_baset<T>::prop_solve()
         Minisat::vec<Minisat::Lit> solver_assumptions;
         convert(assumptions, solver_assumptions);
 
-        if(solver->solve(solver_assumptions))
+        using Minisat::lbool;
+
+        solver->clearInterrupt();
+        lbool solver_result=solver->solveLimited(solver_assumptions);
+
+        if(solver_result==l_True)
         {
           messaget::status() <<
             "SAT checker: instance is SATISFIABLE" << eom;
@@ -254,6 +281,13 @@ propt::resultt satcheck_minisat2_baset<T>::prop_solve()
           status=SAT;
           return P_SATISFIABLE;
         }
+        else if(solver_result==l_Undef)
+        {
+          messaget::status() <<
+            "SAT checker was interrupted" << eom;
+          status=INIT;
+          return P_ERROR;
+        }
         else
         {
           messaget::status() <<
@@ -368,6 +402,24 @@ bool satcheck_minisat2_baset<T>::is_in_conflict(literalt a) const
 
 /*******************************************************************\
 
+Function: satcheck_minisat2_baset::interrupt
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+template<typename T>
+void satcheck_minisat2_baset<T>::interrupt()
+{
+  solver->interrupt();
+}
+
+/*******************************************************************\
+
 Function: satcheck_minisat2_baset::set_assumptions
 
   Inputs:
@@ -41,10 +41,18 @@ public:
   // extra MiniSat feature: default branching decision
   void set_polarity(literalt a, bool value);
 
+  // extra MiniSat feature: randomise the initial variable order
+  // and some of the decisions, using the given seed, which needs
+  // to be positive; this is for solvers without variables
+  void set_random_seed(double seed);
+
   virtual bool is_in_conflict(literalt a) const override;
   virtual bool has_set_assumptions() const final { return true; }
   virtual bool has_is_in_conflict() const final { return true; }
 
+  virtual void interrupt() final;
+  virtual bool has_interrupt() const final { return true; }
+
 protected:
   T *solver;
 
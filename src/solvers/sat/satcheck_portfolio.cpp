@@ -0,0 +1,510 @@
+/*******************************************************************\
+
+Module: Portfolio of SAT Solvers
+
+Author:
+
+\*******************************************************************/
+
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#ifdef HAVE_MINISAT2
+#include "satcheck_minisat2.h"
+#endif
+
+#ifdef HAVE_GLUCOSE
+#include "satcheck_glucose.h"
+#endif
+
+#ifdef HAVE_LINGELING
+#include "satcheck_lingeling.h"
+#endif
+
+#include "satcheck_portfolio.h"
+
+/*******************************************************************\
+
+   Class: portfolio_runt
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: the state shared by the threads of one call to prop_solve
+
+\*******************************************************************/
+
+class portfolio_runt
+{
+public:
+  explicit portfolio_runt(std::size_t number_of_solvers):
+    running(number_of_solvers),
+    finished(number_of_solvers, false),
+    winner(number_of_solvers),
+    result(propt::P_ERROR)
+  {
+  }
+
+  std::mutex mutex;
+  std::condition_variable finished_cond;
+
+  std::size_t running;
+  std::vector<bool> finished;
+
+  // the index of the first solver with an answer,
+  // or the number of solvers if there is none yet
+  std::size_t winner;
+  propt::resultt result;
+};
+
+/*******************************************************************\
+
+Function: run_solver
+
+  Inputs: a solver, its index, the shared state
+
+ Outputs:
+
+ Purpose: thread body
+
+\*******************************************************************/
+
+static void run_solver(
+  cnf_solvert &solver,
+  std::size_t index,
+  portfolio_runt &run)
+{
+  propt::resultt result=solver.prop_solve();
+
+  std::lock_guard<std::mutex> lock(run.mutex);
+
+  if(run.winner==run.finished.size() && result!=propt::P_ERROR)
+  {
+    run.winner=index;
+    run.result=result;
+  }
+
+  run.finished[index]=true;
+  run.running--;
+  run.finished_cond.notify_all();
+}
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::satcheck_portfoliot
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+satcheck_portfoliot::satcheck_portfoliot():
+  winner(NULL)
+{
+}
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::~satcheck_portfoliot
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+satcheck_portfoliot::~satcheck_portfoliot()
+{
+  for(auto solver : solvers)
+    delete solver;
+}
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::add_solver
+
+  Inputs: a solver that hasn't been given any clauses yet
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void satcheck_portfoliot::add_solver(cnf_solvert *solver)
+{
+  assert(clause_counter==0);
+
+  // the solvers run concurrently, and thus mustn't
+  // share the message handler
+  solver->set_message_handler(null_message_handler);
+  solvers.push_back(solver);
+}
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::add_default_solvers
+
+  Inputs: whether the solvers may eliminate variables
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void satcheck_portfoliot::add_default_solvers(bool simplifier)
+{
+  #ifdef HAVE_MINISAT2
+  if(simplifier)
+    add_solver(new satcheck_minisat_simplifiert());
+  else
+    add_solver(new satcheck_minisat_no_simplifiert());
+
+  // MiniSat once more, with a randomised search, such that
+  // there is a choice even if it's the only solver compiled in
+  if(simplifier)
+  {
+    satcheck_minisat_simplifiert *solver=new satcheck_minisat_simplifiert();
+    solver->set_random_seed(1234567);
+    add_solver(solver);
+  }
+  else
+  {
+    satcheck_minisat_no_simplifiert *solver=
+      new satcheck_minisat_no_simplifiert();
+    solver->set_random_seed(1234567);
+    add_solver(solver);
+  }
+  #endif
+
+  #ifdef HAVE_GLUCOSE
+  if(simplifier)
+    add_solver(new satcheck_glucose_simplifiert());
+  else
+    add_solver(new satcheck_glucose_no_simplifiert());
+  #endif
+
+  #ifdef HAVE_LINGELING
+  // Lingeling always eliminates variables that aren't frozen
+  if(simplifier)
+    add_solver(new satcheck_lingelingt());
+  #endif
+}
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::solver_text
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+const std::string satcheck_portfoliot::solver_text()
+{
+  std::string result="portfolio of";
+
+  for(std::size_t i=0; i<solvers.size(); i++)
+  {
+    result+=(i==0?" ":", ");
+    result+=solvers[i]->solver_text();
+  }
+
+  return result;
+}
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::add_variables
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: the variables are allocated by the portfolio,
+          and the solvers need to know about them
+
+\*******************************************************************/
+
+void satcheck_portfoliot::add_variables()
+{
+  for(auto solver : solvers)
+    if(solver->no_variables()<no_variables())
+      solver->set_no_variables(no_variables());
+}
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::answering_solver
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+cnf_solvert &satcheck_portfoliot::answering_solver() const
+{
+  assert(!solvers.empty());
+  return winner==NULL?*solvers.front():*winner;
+}
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::lcnf
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void satcheck_portfoliot::lcnf(const bvt &bv)
+{
+  add_variables();
+
+  for(auto solver : solvers)
+    solver->lcnf(bv);
+
+  clause_counter++;
+}
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::prop_solve
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+propt::resultt satcheck_portfoliot::prop_solve()
+{
+  assert(status!=ERROR);
+  assert(!solvers.empty());
+
+  // We start counting at 1, thus there is one variable fewer.
+  messaget::status() <<
+    (no_variables()-1) << " variables, " <<
+    clause_counter << " clauses" << eom;
+
+  add_variables();
+
+  messaget::status() <<
+    "SAT checker portfolio: running " << solvers.size() <<
+    " solvers" << eom;
+
+  winner=NULL;
+
+  portfolio_runt run(solvers.size());
+
+  std::vector<std::thread> threads;
+  threads.reserve(solvers.size());
+
+  for(std::size_t i=0; i<solvers.size(); i++)
+    threads.push_back(
+      std::thread(run_solver, std::ref(*solvers[i]), i, std::ref(run)));
+
+  {
+    std::unique_lock<std::mutex> lock(run.mutex);
+
+    while(run.winner==solvers.size() && run.running!=0)
+      run.finished_cond.wait(lock);
+
+    // A solver that is just starting may miss the interrupt,
+    // hence we repeat it until all have stopped.
+    while(run.running!=0)
+    {
+      for(std::size_t i=0; i<solvers.size(); i++)
+        if(!run.finished[i])
+          solvers[i]->interrupt();
+
+      run.finished_cond.wait_for(lock, std::chrono::milliseconds(10));
+    }
+  }
+
+  for(auto &t : threads)
+    t.join();
+
+  if(run.winner==solvers.size())
+  {
+    messaget::error() << "all SAT checkers of the portfolio failed" << eom;
+    status=ERROR;
+    return P_ERROR;
+  }
+
+  winner=solvers[run.winner];
+
+  messaget::status() <<
+    "SAT checker portfolio: " << winner->solver_text() <<
+    " answered first" << eom;
+
+  if(run.result==P_SATISFIABLE)
+  {
+    messaget::status() <<
+      "SAT checker: instance is SATISFIABLE" << eom;
+    status=SAT;
+  }
+  else
+  {
+    messaget::status() <<
+      "SAT checker: instance is UNSATISFIABLE" << eom;
+    status=UNSAT;
+  }
+
+  return run.result;
+}
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::l_get
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+tvt satcheck_portfoliot::l_get(literalt a) const
+{
+  return answering_solver().l_get(a);
+}
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::set_assignment
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void satcheck_portfoliot::set_assignment(literalt a, bool value)
+{
+  add_variables();
+  answering_solver().set_assignment(a, value);
+}
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::set_assumptions
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void satcheck_portfoliot::set_assumptions(const bvt &_assumptions)
+{
+  add_variables();
+
+  for(auto solver : solvers)
+    solver->set_assumptions(_assumptions);
+}
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::has_set_assumptions
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bool satcheck_portfoliot::has_set_assumptions() const
+{
+  for(auto solver : solvers)
+    if(!solver->has_set_assumptions())
+      return false;
+
+  return true;
+}
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::is_in_conflict
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bool satcheck_portfoliot::is_in_conflict(literalt a) const
+{
+  return answering_solver().is_in_conflict(a);
+}
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::has_is_in_conflict
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bool satcheck_portfoliot::has_is_in_conflict() const
+{
+  for(auto solver : solvers)
+    if(!solver->has_is_in_conflict())
+      return false;
+
+  return true;
+}
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::set_frozen
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void satcheck_portfoliot::set_frozen(literalt a)
+{
+  add_variables();
+
+  for(auto solver : solvers)
+    solver->set_frozen(a);
+}
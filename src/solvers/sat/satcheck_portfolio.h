@@ -0,0 +1,68 @@
+/*******************************************************************\
+
+Module: Portfolio of SAT Solvers
+
+Author:
+
+\*******************************************************************/
+
+#ifndef CPROVER_SOLVERS_SAT_SATCHECK_PORTFOLIO_H
+#define CPROVER_SOLVERS_SAT_SATCHECK_PORTFOLIO_H
+
+#include <vector>
+
+#include "cnf.h"
+
+/*! \brief Passes the same clauses to several SAT solvers, runs them
+           in separate threads, and takes the first answer
+
+  The satisfying assignment and the conflicts are those of the
+  solver that answered first. The other solvers are stopped using
+  propt::interrupt; solvers that do not support it are waited for.
+*/
+class satcheck_portfoliot:public cnf_solvert
+{
+public:
+  satcheck_portfoliot();
+  virtual ~satcheck_portfoliot();
+
+  // takes ownership of the solver
+  void add_solver(cnf_solvert *solver);
+
+  // adds all solvers that are compiled in and can be interrupted,
+  // and a second, randomised configuration of MiniSat
+  void add_default_solvers(bool simplifier);
+
+  std::size_t number_of_solvers() const
+  {
+    return solvers.size();
+  }
+
+  virtual const std::string solver_text() override;
+  virtual resultt prop_solve() override;
+  virtual tvt l_get(literalt a) const override;
+
+  virtual void lcnf(const bvt &bv) override;
+  virtual void set_assignment(literalt a, bool value) override;
+
+  virtual void set_assumptions(const bvt &_assumptions) override;
+  virtual bool has_set_assumptions() const override;
+  virtual bool is_in_conflict(literalt a) const override;
+  virtual bool has_is_in_conflict() const override;
+  virtual void set_frozen(literalt a) override;
+
+protected:
+  typedef std::vector<cnf_solvert *> solverst;
+  solverst solvers;
+
+  // the solver that answered the last call to prop_solve
+  cnf_solvert *winner;
+
+  null_message_handlert null_message_handler;
+
+  void add_variables();
+
+  cnf_solvert &answering_solver() const;
+};
+
+#endif // CPROVER_SOLVERS_SAT_SATCHECK_PORTFOLIO_H
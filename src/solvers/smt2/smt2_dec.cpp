@@ -22,6 +22,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/tempfile.h>
 #include <util/arith_tools.h>
 #include <util/ieee_float.h>
+#include <util/pipe_stream.h>
 
 #include "smt2_dec.h"
 #include "smt2irep.h"
@@ -100,6 +101,120 @@ smt2_temp_filet::~smt2_temp_filet()
 
 /*******************************************************************\
 
+Function: smt2_dect::smt2_dect
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+smt2_dect::smt2_dect(
+  const namespacet &_ns,
+  const std::string &_benchmark,
+  const std::string &_notes,
+  const std::string &_logic,
+  solvert _solver):
+  smt2_convt(_ns, _benchmark, _notes, _logic, _solver, stringstream),
+  process_failed(false)
+{
+}
+
+/*******************************************************************\
+
+Function: smt2_dect::~smt2_dect
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+smt2_dect::~smt2_dect()
+{
+  if(process!=NULL)
+  {
+    *process << "(exit)\n" << std::flush;
+    process->wait();
+  }
+}
+
+/*******************************************************************\
+
+Function: smt2_dect::solver_is_interactive
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: whether the solver is known to support push, pop and
+          check-sat-assuming when reading from a pipe
+
+\*******************************************************************/
+
+bool smt2_dect::solver_is_interactive() const
+{
+  return solver==CVC4 || solver==YICES || solver==Z3;
+}
+
+/*******************************************************************\
+
+Function: smt2_dect::start_process
+
+  Inputs:
+
+ Outputs: true on error
+
+ Purpose:
+
+\*******************************************************************/
+
+bool smt2_dect::start_process()
+{
+  std::string executable;
+  std::list<std::string> args;
+
+  switch(solver)
+  {
+  case CVC4:
+    executable="cvc4";
+    args.push_back("--lang");
+    args.push_back("smt2");
+    args.push_back("--incremental");
+    break;
+
+  case YICES:
+    executable="yices-smt2";
+    args.push_back("--incremental");
+    break;
+
+  case Z3:
+    executable="z3";
+    args.push_back("-smt2");
+    args.push_back("-in");
+    break;
+
+  default:
+    assert(false);
+  }
+
+  process=std::unique_ptr<pipe_streamt>(new pipe_streamt(executable, args));
+
+  if(process->run()<0)
+  {
+    process.reset();
+    return true;
+  }
+
+  return false;
+}
+
+/*******************************************************************\
+
 Function: smt2_dect::dec_solve
 
   Inputs:
@@ -112,6 +227,9 @@ Function: smt2_dect::dec_solve
 
 decision_proceduret::resultt smt2_dect::dec_solve()
 {
+  if(solver_is_interactive())
+    return dec_solve_interactive();
+
   // we write the problem into a file
   smt2_temp_filet smt2_temp_file;
 
@@ -233,10 +351,6 @@ decision_proceduret::resultt smt2_dect::read_result(std::istream &in)
   std::string line;
   decision_proceduret::resultt res=D_ERROR;
 
-  boolean_assignment.clear();
-  boolean_assignment.resize(no_boolean_variables, false);
-
-  typedef std::unordered_map<irep_idt, irept, irep_id_hash> valuest;
   valuest values;
 
   while(in)
@@ -275,6 +389,28 @@ decision_proceduret::resultt smt2_dect::read_result(std::istream &in)
     }
   }
 
+  set_values(values);
+
+  return res;
+}
+
+/*******************************************************************\
+
+Function: smt2_dect::set_values
+
+  Inputs: the values the solver gave, by SMT2 identifier
+
+ Outputs:
+
+ Purpose: store the satisfying assignment
+
+\*******************************************************************/
+
+void smt2_dect::set_values(valuest &values)
+{
+  boolean_assignment.clear();
+  boolean_assignment.resize(no_boolean_variables, false);
+
   for(identifier_mapt::iterator
       it=identifier_map.begin();
       it!=identifier_map.end();
@@ -291,6 +427,171 @@ decision_proceduret::resultt smt2_dect::read_result(std::istream &in)
     const irept &value=values["B"+std::to_string(v)];
     boolean_assignment[v]=(value.id()==ID_true);
   }
+}
+
+/*******************************************************************\
+
+Function: smt2_dect::dec_solve_interactive
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Passes what has been converted since the last call to
+          the solver process, which is started on the first call.
+          The assumptions and the object sizes are only asserted
+          within a push/pop scope, so that the next call can
+          use different ones.
+
+\*******************************************************************/
+
+decision_proceduret::resultt smt2_dect::dec_solve_interactive()
+{
+  if(process_failed)
+    return D_ERROR;
+
+  if(process==NULL && start_process())
+  {
+    error() << "error running SMT2 solver" << eom;
+    process_failed=true;
+    return D_ERROR;
+  }
+
+  out << "\n(push 1)\n";
+
+  // fix up the object sizes
+  for(const auto &object : object_sizes)
+    define_object_size(object.second, object.first);
+
+  // check-sat-assuming takes propositional variables only, so
+  // the constant assumptions are dealt with here
+  bvt literals;
+
+  forall_literals(it, assumptions)
+  {
+    if(it->is_false())
+      out << "(assert false)\n";
+    else if(!it->is_true())
+      literals.push_back(*it);
+  }
+
+  if(literals.empty())
+    out << "(check-sat)\n";
+  else
+  {
+    out << "(check-sat-assuming (";
+
+    forall_literals(it, literals)
+    {
+      out << " ";
+      convert_literal(*it);
+    }
+
+    out << "))\n";
+  }
+
+  *process << stringstream.str() << std::flush;
+  stringstream.str(std::string());
+
+  resultt res=read_result_interactive();
+
+  if(res==D_ERROR)
+  {
+    // we can't tell what state the solver is in
+    process_failed=true;
+    return D_ERROR;
+  }
+
+  *process << "(pop 1)\n" << std::flush;
+
+  return res;
+}
+
+/*******************************************************************\
+
+Function: smt2_dect::read_result_interactive
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: read the answer to check-sat, and the satisfying
+          assignment, if any, from the solver process
+
+\*******************************************************************/
+
+decision_proceduret::resultt smt2_dect::read_result_interactive()
+{
+  resultt res=D_ERROR;
+
+  while(res==D_ERROR)
+  {
+    irept parsed=smt2irep(*process);
+
+    if(!*process)
+    {
+      error() << "SMT2 solver terminated unexpectedly" << eom;
+      return D_ERROR;
+    }
+
+    if(parsed.id()=="sat")
+      res=D_SATISFIABLE;
+    else if(parsed.id()=="unsat")
+      res=D_UNSATISFIABLE;
+    else if(parsed.id()=="unknown")
+    {
+      error() << "SMT2 solver returned `unknown'" << eom;
+      return D_ERROR;
+    }
+    else if(parsed.id()=="" &&
+            parsed.get_sub().size()==2 &&
+            parsed.get_sub().front().id()=="error")
+    {
+      error() << "SMT2 solver returned error message:\n"
+              << "\t\"" << parsed.get_sub()[1].id() <<"\"" << eom;
+      return D_ERROR;
+    }
+  }
+
+  if(res==D_UNSATISFIABLE)
+    return res;
+
+  valuest values;
+
+  if(!smt2_identifiers.empty())
+  {
+    *process << "(get-value (";
+
+    for(const auto &id : smt2_identifiers)
+      *process << " |" << id << "|";
+
+    *process << "))\n" << std::flush;
+
+    irept parsed=smt2irep(*process);
+
+    if(!*process)
+    {
+      error() << "SMT2 solver terminated unexpectedly" << eom;
+      return D_ERROR;
+    }
+
+    if(parsed.id()=="" &&
+       parsed.get_sub().size()==2 &&
+       parsed.get_sub().front().id()=="error")
+    {
+      error() << "SMT2 solver returned error message:\n"
+              << "\t\"" << parsed.get_sub()[1].id() <<"\"" << eom;
+      return D_ERROR;
+    }
+
+    // Example:
+    // ( (B0 true) (|__CPROVER_pipe_count#1| (_ bv0 32)) )
+    for(const auto &value : parsed.get_sub())
+      if(value.get_sub().size()==2)
+        values[value.get_sub()[0].id()]=value.get_sub()[1];
+  }
+
+  set_values(values);
 
   return res;
 }
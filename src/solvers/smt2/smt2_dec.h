@@ -12,9 +12,12 @@ Author: Daniel Kroening, kroening@kroening.com
 /*! \defgroup gr_smt2 SMT-LIB 2.x Interface */
 
 #include <fstream>
+#include <memory>
 
 #include "smt2_conv.h"
 
+class pipe_streamt;
+
 class smt2_temp_filet
 {
 public:
@@ -42,10 +45,9 @@ public:
     const std::string &_benchmark,
     const std::string &_notes,
     const std::string &_logic,
-    solvert _solver):
-    smt2_convt(_ns, _benchmark, _notes, _logic, _solver, stringstream)
-  {
-  }
+    solvert _solver);
+
+  virtual ~smt2_dect();
 
   virtual resultt dec_solve();
   virtual std::string decision_procedure_text() const;
@@ -54,7 +56,20 @@ public:
   virtual bool has_set_assumptions() const { return true; }
 
 protected:
+  typedef std::unordered_map<irep_idt, irept, irep_id_hash> valuest;
+
   resultt read_result(std::istream &in);
+  void set_values(valuest &values);
+
+  // Solvers that support it are kept running between calls
+  // to dec_solve, and are given only what is new.
+  std::unique_ptr<pipe_streamt> process;
+  bool process_failed;
+
+  bool solver_is_interactive() const;
+  bool start_process();
+  resultt dec_solve_interactive();
+  resultt read_result_interactive();
 };
 
 #endif // CPROVER_SOLVERS_SMT2_SMT2_DEC_H
@@ -6,6 +6,17 @@ Author: Daniel Kroening, kroening@kroening.com
 
 \*******************************************************************/
 
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include <cerrno>
+#include <fstream>
+
+#include <util/irep_serialization.h>
+#include <util/message_buffer.h>
+#include <util/tempfile.h>
 #include <util/time_stopping.h>
 
 #include <solvers/flattening/bv_pointers.h>
@@ -57,7 +68,42 @@ path_searcht::resultt path_searcht::operator()(
 
   initialize_property_map(goto_functions);
 
-  while(!queue.empty())
+  if(workers>1 && !show_vcc)
+  {
+    // Find enough states to keep the workers busy. Breadth-first
+    // search yields states with similar amounts of work left.
+    search_heuristict heuristic=search_heuristic;
+    search_heuristic=search_heuristict::BFS;
+    search(4*workers);
+    search_heuristic=heuristic;
+
+    if(!queue.empty())
+      search_in_parallel(locs);
+  }
+
+  search(0);
+
+  report_statistics();
+
+  return number_of_failed_properties==0?SAFE:UNSAFE;
+}
+
+/*******************************************************************\
+
+Function: path_searcht::search
+
+  Inputs: the size of the queue at which to stop, or 0
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void path_searcht::search(std::size_t max_queue_size)
+{
+  while(!queue.empty() &&
+        (max_queue_size==0 || queue.size()<max_queue_size))
   {
     number_of_steps++;
 
@@ -152,10 +198,431 @@ path_searcht::resultt path_searcht::operator()(
       number_of_dropped_states++;
     }
   }
+}
+
+/*******************************************************************\
+
+Function: write_goto_trace
+
+  Inputs: stream, trace, map from instructions to locations,
+          serializer
+
+ Outputs:
+
+ Purpose: the instructions are given by their location number,
+          as the parent process has the same locations
+
+\*******************************************************************/
+
+static void write_goto_trace(
+  std::ostream &out,
+  const goto_tracet &goto_trace,
+  const target_to_loc_mapt &target_to_loc_map,
+  irep_serializationt &irepconverter)
+{
+  write_gb_string(out, id2string(goto_trace.mode));
+  write_gb_word(out, goto_trace.steps.size());
+
+  for(const auto &step : goto_trace.steps)
+  {
+    write_gb_word(out, step.step_nr);
+    write_gb_word(out, step.type);
+    write_gb_word(out, step.hidden);
+    write_gb_word(out, step.assignment_type);
+    write_gb_word(out, target_to_loc_map[step.pc].loc_number);
+    write_gb_word(out, step.thread_nr);
+    write_gb_word(out, step.cond_value);
+    irepconverter.reference_convert(step.cond_expr, out);
+    write_gb_string(out, step.comment);
+    irepconverter.reference_convert(step.lhs_object, out);
+    irepconverter.reference_convert(step.full_lhs, out);
+    irepconverter.reference_convert(step.lhs_object_value, out);
+    irepconverter.reference_convert(step.full_lhs_value, out);
+    write_gb_string(out, id2string(step.format_string));
+    write_gb_string(out, id2string(step.io_id));
+
+    write_gb_word(out, step.io_args.size());
+    for(const auto &arg : step.io_args)
+      irepconverter.reference_convert(arg, out);
+
+    write_gb_word(out, step.formatted);
+    write_gb_string(out, id2string(step.identifier));
+  }
+}
 
-  report_statistics();
+/*******************************************************************\
 
-  return number_of_failed_properties==0?SAFE:UNSAFE;
+Function: read_goto_trace
+
+  Inputs: stream, locations, serializer
+
+ Outputs: the trace
+
+ Purpose: reads what write_goto_trace has written
+
+\*******************************************************************/
+
+static void read_goto_trace(
+  std::istream &in,
+  goto_tracet &goto_trace,
+  const locst &locs,
+  irep_serializationt &irepconverter)
+{
+  goto_trace.mode=irepconverter.read_gb_string(in);
+
+  std::size_t count=irepconverter.read_gb_word(in);
+
+  for(std::size_t i=0; i<count && in; i++)
+  {
+    goto_trace.steps.push_back(goto_trace_stept());
+    goto_trace_stept &step=goto_trace.steps.back();
+
+    step.step_nr=irepconverter.read_gb_word(in);
+    step.type=
+      static_cast<goto_trace_stept::typet>(irepconverter.read_gb_word(in));
+    step.hidden=irepconverter.read_gb_word(in)!=0;
+    step.assignment_type=
+      static_cast<goto_trace_stept::assignment_typet>(
+        irepconverter.read_gb_word(in));
+
+    std::size_t loc_number=irepconverter.read_gb_word(in);
+    if(loc_number>=locs.size())
+    {
+      in.setstate(std::ios::failbit);
+      return;
+    }
+    step.pc=locs.loc_vector[loc_number].target;
+
+    step.thread_nr=irepconverter.read_gb_word(in);
+    step.cond_value=irepconverter.read_gb_word(in)!=0;
+    irepconverter.reference_convert(in, step.cond_expr);
+    step.comment=id2string(irepconverter.read_gb_string(in));
+    irepconverter.reference_convert(in, step.lhs_object);
+    irepconverter.reference_convert(in, step.full_lhs);
+    irepconverter.reference_convert(in, step.lhs_object_value);
+    irepconverter.reference_convert(in, step.full_lhs_value);
+    step.format_string=irepconverter.read_gb_string(in);
+    step.io_id=irepconverter.read_gb_string(in);
+
+    std::size_t io_args=irepconverter.read_gb_word(in);
+    for(std::size_t j=0; j<io_args && in; j++)
+    {
+      step.io_args.push_back(exprt());
+      irepconverter.reference_convert(in, step.io_args.back());
+    }
+
+    step.formatted=irepconverter.read_gb_word(in)!=0;
+    step.identifier=irepconverter.read_gb_string(in);
+  }
+}
+
+/*******************************************************************\
+
+Function: path_searcht::search_in_parallel
+
+  Inputs: the locations
+
+ Outputs:
+
+ Purpose: Each state in the queue is explored by a worker process,
+          which does not share any ireps with the others, and hence
+          needs no synchronisation. Up to 'workers' of them run at
+          the same time; whenever one is done, the next state is
+          handed out. The results are merged as they come in; for
+          a property that fails on several states, the trace of the
+          one earlier in the queue is kept. The states of workers
+          that fail are left in the queue, to be explored here.
+
+\*******************************************************************/
+
+void path_searcht::search_in_parallel(const locst &locs)
+{
+  #ifndef _WIN32
+  std::vector<queuet::iterator> tasks;
+
+  for(queuet::iterator it=queue.begin(); it!=queue.end(); it++)
+    tasks.push_back(it);
+
+  status() << "Exploring " << tasks.size() << " states with "
+           << workers << " processes" << eom;
+
+  std::list<temporary_filet> result_files;
+  std::vector<std::string> result_file_names(tasks.size());
+  std::vector<bool> done(tasks.size(), false);
+  std::map<pid_t, std::size_t> running;
+  std::map<irep_idt, std::size_t> trace_task;
+
+  std::size_t next=0;
+
+  while(true)
+  {
+    const bool all_failed=
+      number_of_failed_properties==property_map.size();
+
+    if(next<tasks.size() && running.size()<workers && !all_failed)
+    {
+      result_files.emplace_back("path_search_", ".bin");
+      result_file_names[next]=result_files.back()();
+
+      pid_t pid=fork();
+
+      if(pid==0)
+      {
+        // don't run destructors or flush streams of the parent
+        _exit(
+          search_worker(tasks[next], locs, result_file_names[next])?1:0);
+      }
+
+      if(pid>0)
+        running[pid]=next;
+
+      next++;
+      continue;
+    }
+
+    if(running.empty())
+      break;
+
+    int status;
+    pid_t pid=waitpid(-1, &status, 0);
+
+    if(pid<0)
+    {
+      if(errno==EINTR)
+        continue;
+      break;
+    }
+
+    std::map<pid_t, std::size_t>::iterator r_it=running.find(pid);
+    if(r_it==running.end())
+      continue;
+
+    const std::size_t task=r_it->second;
+    running.erase(r_it);
+
+    done[task]=
+      WIFEXITED(status) &&
+      WEXITSTATUS(status)==0 &&
+      !merge_worker_result(
+        locs, result_file_names[task], task, trace_task);
+
+    if(!done[task])
+      debug() << "Exploring state " << task << " sequentially" << eom;
+  }
+
+  // we stop once all properties have failed
+  const bool all_failed=
+    number_of_failed_properties==property_map.size();
+
+  for(std::size_t i=0; i<tasks.size(); i++)
+    if(done[i] || all_failed)
+      queue.erase(tasks[i]);
+  #endif
+}
+
+/*******************************************************************\
+
+Function: path_searcht::search_worker
+
+  Inputs: the state to explore, the locations, file name for
+          the result
+
+ Outputs: true on error
+
+ Purpose: explores the given state, and writes the messages,
+          statistics and properties into the file
+
+\*******************************************************************/
+
+bool path_searcht::search_worker(
+  queuet::iterator state,
+  const locst &locs,
+  const std::string &result_file)
+{
+  message_buffert message_buffer;
+  set_message_handler(message_buffer);
+
+  queuet tmp_queue;
+  tmp_queue.splice(tmp_queue.begin(), queue, state);
+  queue.swap(tmp_queue);
+
+  // the statistics are those of this worker
+  number_of_dropped_states=0;
+  number_of_paths=0;
+  number_of_VCCs=0;
+  number_of_steps=0;
+  number_of_feasible_paths=0;
+  number_of_infeasible_paths=0;
+  number_of_VCCs_after_simplification=0;
+  sat_time.clear();
+  loc_data.clear();
+
+  std::set<irep_idt> failed_before;
+
+  for(const auto &p : property_map)
+    if(p.second.is_failure())
+      failed_before.insert(p.first);
+
+  try
+  {
+    search(0);
+  }
+
+  catch(...)
+  {
+    return true;
+  }
+
+  std::ofstream out(result_file, std::ios::binary);
+
+  irep_serializationt::ireps_containert ic;
+  irep_serializationt irepconverter(ic);
+
+  message_buffer.write(out, irepconverter);
+
+  write_gb_word(out, number_of_dropped_states);
+  write_gb_word(out, number_of_paths);
+  write_gb_word(out, number_of_VCCs);
+  write_gb_word(out, number_of_steps);
+  write_gb_word(out, number_of_feasible_paths);
+  write_gb_word(out, number_of_infeasible_paths);
+  write_gb_word(out, number_of_VCCs_after_simplification);
+  write_gb_word(out, sat_time.get_t());
+
+  std::vector<std::size_t> visited;
+  for(std::size_t l=0; l<loc_data.size(); l++)
+    if(loc_data[l].visited)
+      visited.push_back(l);
+
+  write_gb_word(out, visited.size());
+  for(const auto l : visited)
+    write_gb_word(out, l);
+
+  target_to_loc_mapt target_to_loc_map(locs);
+
+  write_gb_word(out, property_map.size());
+
+  for(const auto &p : property_map)
+  {
+    write_gb_string(out, id2string(p.first));
+    write_gb_word(out, p.second.status);
+
+    if(p.second.is_failure() &&
+       failed_before.find(p.first)==failed_before.end())
+    {
+      write_gb_word(out, 1);
+      write_goto_trace(
+        out, p.second.error_trace, target_to_loc_map, irepconverter);
+    }
+    else
+      write_gb_word(out, 0);
+  }
+
+  out.close();
+
+  return !out;
+}
+
+/*******************************************************************\
+
+Function: path_searcht::merge_worker_result
+
+  Inputs: the locations, the file written by the worker, the
+          index of its state, the states the traces come from
+
+ Outputs: true on error, in which case nothing has been changed
+
+ Purpose: passes on the messages of the worker, and adds its
+          statistics and properties
+
+\*******************************************************************/
+
+bool path_searcht::merge_worker_result(
+  const locst &locs,
+  const std::string &result_file,
+  std::size_t task,
+  std::map<irep_idt, std::size_t> &trace_task)
+{
+  std::ifstream in(result_file, std::ios::binary);
+
+  irep_serializationt::ireps_containert ic;
+  irep_serializationt irepconverter(ic);
+
+  message_buffert message_buffer;
+  message_buffer.read(in, irepconverter);
+
+  std::vector<std::size_t> numbers;
+  for(unsigned i=0; i<8; i++)
+    numbers.push_back(irepconverter.read_gb_word(in));
+
+  std::vector<std::size_t> visited(irepconverter.read_gb_word(in));
+  for(std::size_t i=0; i<visited.size() && in; i++)
+    visited[i]=irepconverter.read_gb_word(in);
+
+  struct propertyt
+  {
+    irep_idt name;
+    statust status;
+    bool has_trace;
+    goto_tracet error_trace;
+  };
+
+  std::list<propertyt> properties;
+  std::size_t count=irepconverter.read_gb_word(in);
+
+  for(std::size_t i=0; i<count && in; i++)
+  {
+    properties.push_back(propertyt());
+    propertyt &property=properties.back();
+
+    property.name=irepconverter.read_gb_string(in);
+    property.status=static_cast<statust>(irepconverter.read_gb_word(in));
+    property.has_trace=irepconverter.read_gb_word(in)!=0;
+
+    if(property.has_trace)
+      read_goto_trace(in, property.error_trace, locs, irepconverter);
+  }
+
+  if(!in)
+    return true;
+
+  message_buffer.replay(get_message_handler());
+
+  number_of_dropped_states+=numbers[0];
+  number_of_paths+=numbers[1];
+  number_of_VCCs+=numbers[2];
+  number_of_steps+=numbers[3];
+  number_of_feasible_paths+=numbers[4];
+  number_of_infeasible_paths+=numbers[5];
+  number_of_VCCs_after_simplification+=numbers[6];
+  sat_time+=time_periodt(numbers[7]);
+
+  for(const auto l : visited)
+    loc_data[l].visited=true;
+
+  for(auto &property : properties)
+  {
+    property_entryt &entry=property_map[property.name];
+
+    if(property.status==FAILURE && property.has_trace)
+    {
+      if(!entry.is_failure())
+      {
+        entry.status=FAILURE;
+        number_of_failed_properties++;
+      }
+      else if(trace_task.find(property.name)==trace_task.end() ||
+              trace_task[property.name]<task)
+        continue;
+
+      entry.error_trace.swap(property.error_trace);
+      trace_task[property.name]=task;
+    }
+    else if(property.status==SUCCESS && entry.is_not_reached())
+      entry.status=SUCCESS;
+  }
+
+  return false;
 }
 
 /*******************************************************************\
@@ -27,7 +27,8 @@ public:
     context_bound_set(false),
     unwind_limit_set(false),
     branch_bound_set(false),
-    search_heuristic(search_heuristict::DFS)
+    search_heuristic(search_heuristict::DFS),
+    workers(1)
   {
   }
 
@@ -58,6 +59,12 @@ public:
     unwind_limit=limit;
   }
 
+  // explore the paths with the given number of processes
+  void set_workers(unsigned _workers)
+  {
+    workers=_workers;
+  }
+
   bool show_vcc;
   bool eager_infeasibility;
 
@@ -106,6 +113,22 @@ protected:
   // search heuristic
   void pick_state();
 
+  // explores the states in the queue, until there are
+  // max_queue_size many (0 for no limit)
+  void search(std::size_t max_queue_size);
+
+  // the states in the queue are explored by worker processes
+  void search_in_parallel(const locst &locs);
+  bool search_worker(
+    queuet::iterator state,
+    const locst &locs,
+    const std::string &result_file);
+  bool merge_worker_result(
+    const locst &locs,
+    const std::string &result_file,
+    std::size_t task,
+    std::map<irep_idt, std::size_t> &trace_task);
+
   struct loc_datat
   {
     bool visited;
@@ -134,6 +157,8 @@ protected:
   bool depth_limit_set, context_bound_set, unwind_limit_set, branch_bound_set;
 
   enum class search_heuristict { DFS, BFS, LOCS } search_heuristic;
+
+  unsigned workers;
 };
 
 #endif // CPROVER_SYMEX_PATH_SEARCH_H
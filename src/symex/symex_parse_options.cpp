@@ -237,6 +237,10 @@ int symex_parse_optionst::doit()
     if(cmdline.isset("locs"))
       path_search.set_locs();
 
+    if(cmdline.isset("parallel-paths"))
+      path_search.set_workers(
+        unsafe_string2unsigned(cmdline.get_value("parallel-paths")));
+
     if(cmdline.isset("show-vcc"))
     {
       path_search.show_vcc=true;
@@ -723,6 +727,7 @@ void symex_parse_optionst::help()
     " --depth nr                   limit search depth\n"
     " --context-bound nr           limit number of context switches\n"
     " --branch-bound nr            limit number of branches taken\n"
+    " --parallel-paths n           explore the paths with n processes\n"
     "\n"
     "Other options:\n"
     " --version                    show version and exit\n"
@@ -10,6 +10,8 @@ Date: January 2012
 
 #include <cerrno>
 
+#include <sys/stat.h>
+
 #if defined(__linux__) || \
     defined(__FreeBSD_kernel__) || \
     defined(__GNU__) || \
@@ -144,3 +146,26 @@ std::string concat_dir_file(
           file_name : directory+"/"+file_name;
   #endif
 }
+
+/*******************************************************************\
+
+Function: is_directory
+
+  Inputs: path
+
+ Outputs: true iff 'path' is an existing directory
+
+ Purpose:
+
+\*******************************************************************/
+
+bool is_directory(const std::string &path)
+{
+  #ifdef _WIN32
+  struct _stat info;
+  return _stat(path.c_str(), &info)==0 && (info.st_mode&_S_IFDIR)!=0;
+  #else
+  struct stat info;
+  return stat(path.c_str(), &info)==0 && S_ISDIR(info.st_mode);
+  #endif
+}
@@ -157,6 +157,13 @@ void irept::remove_ref(dt *old_data)
   #endif
 
   old_data->ref_count--;
+
+  #ifdef HASH_CODE
+  // not shared any more, and may thus be changed
+  if(old_data->ref_count==1)
+    old_data->hash_code.set(0);
+  #endif
+
   if(old_data->ref_count==0)
   {
     #ifdef IREP_DEBUG
@@ -206,6 +213,11 @@ void irept::nonrecursive_destructor(dt *old_data)
     assert(d->ref_count!=0);
     d->ref_count--;
 
+    #ifdef HASH_CODE
+    if(d->ref_count==1)
+      d->hash_code.set(0);
+    #endif
+
     if(d->ref_count==0)
     {
       stack.reserve(stack.size()+
@@ -585,6 +597,23 @@ bool irept::operator==(const irept &other) const
     return true;
   #endif
 
+  #ifdef HASH_CODE
+  // stored hash codes are never stale, and thus tell most unequal
+  // ireps apart without walking the trees
+  const std::size_t hash_code=read().hash_code.get();
+  const std::size_t other_hash_code=other.read().hash_code.get();
+
+  if(hash_code!=0 &&
+     other_hash_code!=0 &&
+     hash_code!=other_hash_code)
+  {
+    #ifdef IREP_HASH_STATS
+    ++irep_cmp_ne_cnt;
+    #endif
+    return false;
+  }
+  #endif
+
   if(id()!=other.id() ||
      get_sub()!=other.get_sub() || // recursive call
      get_named_sub()!=other.get_named_sub()) // recursive call
@@ -852,8 +881,9 @@ unsigned long long irep_hash_cnt=0;
 std::size_t irept::hash() const
 {
   #ifdef HASH_CODE
-  if(read().hash_code!=0)
-    return read().hash_code;
+  const std::size_t hash_code=read().hash_code.get();
+  if(hash_code!=0)
+    return hash_code;
   #endif
 
   const irept::subt &sub=get_sub();
@@ -871,8 +901,10 @@ std::size_t irept::hash() const
 
   result=hash_finalize(result, named_sub.size()+sub.size());
 
-  #ifdef HASH_CODE
-  read().hash_code=result;
+  #if defined(HASH_CODE) && defined(SHARING)
+  // only shared nodes are copied before being changed
+  if(data->ref_count>1)
+    data->hash_code.set(result);
   #endif
   #ifdef IREP_HASH_STATS
   ++irep_hash_cnt;
@@ -16,10 +16,14 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #define USE_DSTRING
 #define SHARING
-// #define HASH_CODE
+#define HASH_CODE
 #define USE_MOVE
 // #define SUB_IS_LIST
 
+#ifdef HASH_CODE
+#include <atomic>
+#endif
+
 #ifdef SUB_IS_LIST
 #include <list>
 #else
@@ -278,7 +282,43 @@ public:
     subt sub;
 
     #ifdef HASH_CODE
-    mutable std::size_t hash_code;
+    // hash() stores the hash code only in nodes that are shared,
+    // which write() copies before changing them, and the code is
+    // reset once the node isn't shared any more. A reference into
+    // a node taken earlier thus can't make its hash code stale.
+    // Shared nodes may be read by several threads.
+    class hash_codet
+    {
+    public:
+      hash_codet():value(0)
+      {
+      }
+
+      hash_codet(const hash_codet &other):value(other.get())
+      {
+      }
+
+      hash_codet &operator=(const hash_codet &other)
+      {
+        set(other.get());
+        return *this;
+      }
+
+      std::size_t get() const
+      {
+        return value.load(std::memory_order_relaxed);
+      }
+
+      void set(std::size_t v)
+      {
+        value.store(v, std::memory_order_relaxed);
+      }
+
+    protected:
+      std::atomic<std::size_t> value;
+    };
+
+    mutable hash_codet hash_code;
     #endif
 
     void clear()
@@ -292,7 +332,7 @@ public:
       named_sub.clear();
       comments.clear();
       #ifdef HASH_CODE
-      hash_code=0;
+      hash_code.set(0);
       #endif
     }
 
@@ -303,22 +343,14 @@ public:
       d.named_sub.swap(named_sub);
       d.comments.swap(comments);
       #ifdef HASH_CODE
-      std::swap(d.hash_code, hash_code);
+      std::size_t tmp=d.hash_code.get();
+      d.hash_code.set(hash_code.get());
+      hash_code.set(tmp);
       #endif
     }
 
     #ifdef SHARING
     dt():ref_count(1)
-      #ifdef HASH_CODE
-         , hash_code(0)
-      #endif
-    {
-    }
-    #else
-    dt()
-      #ifdef HASH_CODE
-      :hash_code(0)
-      #endif
     {
     }
     #endif
@@ -343,7 +375,7 @@ public:
   {
     detach();
     #ifdef HASH_CODE
-    data->hash_code=0;
+    data->hash_code.set(0);
     #endif
     return *data;
   }
@@ -360,7 +392,7 @@ public:
   dt &write()
   {
     #ifdef HASH_CODE
-    data.hash_code=0;
+    data.hash_code.set(0);
     #endif
     return data;
   }
@@ -0,0 +1,810 @@
+// Generated by irep_ids_convert
+
+#ifndef CPROVER_UTIL_IREP_IDS_H
+#define CPROVER_UTIL_IREP_IDS_H
+
+#define ID_let dstringt(1, 0)
+#define ID_nil dstringt(2, 0)
+#define ID_type dstringt(3, 0)
+#define ID_operands dstringt(4, 0)
+#define ID_bool dstringt(5, 0)
+#define ID_c_bool dstringt(6, 0)
+#define ID_proper_bool dstringt(7, 0)
+#define ID_signedbv dstringt(8, 0)
+#define ID_unsignedbv dstringt(9, 0)
+#define ID_verilog_signedbv dstringt(10, 0)
+#define ID_verilog_unsignedbv dstringt(11, 0)
+#define ID_floatbv dstringt(12, 0)
+#define ID_fixedbv dstringt(13, 0)
+#define ID_x86_extended dstringt(14, 0)
+#define ID_C_source_location dstringt(15, 0) // #source_location
+#define ID_C_end_location dstringt(16, 0) // #end_location
+#define ID_C_is_padding dstringt(17, 0) // #is_padding
+#define ID_file dstringt(18, 0)
+#define ID_line dstringt(19, 0)
+#define ID_column dstringt(20, 0)
+#define ID_comment dstringt(21, 0)
+#define ID_property dstringt(22, 0)
+#define ID_property_class dstringt(23, 0)
+#define ID_property_id dstringt(24, 0)
+#define ID_function dstringt(25, 0)
+#define ID_code dstringt(26, 0)
+#define ID_typecast dstringt(27, 0)
+#define ID_static_cast dstringt(28, 0)
+#define ID_dynamic_cast dstringt(29, 0)
+#define ID_const_cast dstringt(30, 0)
+#define ID_reinterpret_cast dstringt(31, 0)
+#define ID_index dstringt(32, 0)
+#define ID_index_range dstringt(33, 0)
+#define ID_ptrmember dstringt(34, 0)
+#define ID_member dstringt(35, 0)
+#define ID_member_name dstringt(36, 0)
+#define ID_C_member_name dstringt(37, 0) // #member_name
+#define ID_equal dstringt(38, 0) // =
+#define ID_implies dstringt(39, 0) // =>
+#define ID_iff dstringt(40, 0) // <=>
+#define ID_and dstringt(41, 0)
+#define ID_nand dstringt(42, 0)
+#define ID_or dstringt(43, 0)
+#define ID_nor dstringt(44, 0)
+#define ID_xor dstringt(45, 0)
+#define ID_xnor dstringt(46, 0)
+#define ID_not dstringt(47, 0)
+#define ID_bitand dstringt(48, 0)
+#define ID_bitor dstringt(49, 0)
+#define ID_bitnot dstringt(50, 0)
+#define ID_bitxor dstringt(51, 0)
+#define ID_bitnand dstringt(52, 0)
+#define ID_bitnor dstringt(53, 0)
+#define ID_bitxnor dstringt(54, 0)
+#define ID_notequal dstringt(55, 0)
+#define ID_if dstringt(56, 0)
+#define ID_symbol dstringt(57, 0)
+#define ID_next_symbol dstringt(58, 0)
+#define ID_nondet_symbol dstringt(59, 0)
+#define ID_predicate dstringt(60, 0)
+#define ID_predicate_symbol dstringt(61, 0)
+#define ID_predicate_next_symbol dstringt(62, 0)
+#define ID_nondet_bool dstringt(63, 0)
+#define ID_empty dstringt(64, 0)
+#define ID_side_effect dstringt(65, 0)
+#define ID_statement dstringt(66, 0)
+#define ID_statement_expression dstringt(67, 0)
+#define ID_value dstringt(68, 0)
+#define ID_constant dstringt(69, 0)
+#define ID_block dstringt(70, 0)
+#define ID_decl dstringt(71, 0)
+#define ID_dead dstringt(72, 0)
+#define ID_assign dstringt(73, 0)
+#define ID_assign_div dstringt(74, 0)
+#define ID_assign_mult dstringt(75, 0) // assign*
+#define ID_assign_plus dstringt(76, 0) // assign+
+#define ID_assign_minus dstringt(77, 0) // assign-
+#define ID_assign_mod dstringt(78, 0)
+#define ID_assign_shl dstringt(79, 0)
+#define ID_assign_shr dstringt(80, 0)
+#define ID_assign_ashr dstringt(81, 0)
+#define ID_assign_lshr dstringt(82, 0)
+#define ID_assign_bitand dstringt(83, 0)
+#define ID_assign_bitxor dstringt(84, 0)
+#define ID_assign_bitor dstringt(85, 0)
+#define ID_assume dstringt(86, 0)
+#define ID_assert dstringt(87, 0)
+#define ID_assertion dstringt(88, 0)
+#define ID_goto dstringt(89, 0)
+#define ID_gcc_computed_goto dstringt(90, 0)
+#define ID_ifthenelse dstringt(91, 0)
+#define ID_label dstringt(92, 0)
+#define ID_break dstringt(93, 0)
+#define ID_continue dstringt(94, 0)
+#define ID_function_call dstringt(95, 0)
+#define ID_return dstringt(96, 0)
+#define ID_skip dstringt(97, 0)
+#define ID_arguments dstringt(98, 0)
+#define ID_array dstringt(99, 0)
+#define ID_size dstringt(100, 0)
+#define ID_pointer dstringt(101, 0)
+#define ID_block_pointer dstringt(102, 0)
+#define ID_switch dstringt(103, 0)
+#define ID_switch_case dstringt(104, 0)
+#define ID_gcc_switch_case_range dstringt(105, 0)
+#define ID_for dstringt(106, 0)
+#define ID_while dstringt(107, 0)
+#define ID_dowhile dstringt(108, 0)
+#define ID_int dstringt(109, 0)
+#define ID_integer dstringt(110, 0)
+#define ID_natural dstringt(111, 0)
+#define ID_real dstringt(112, 0)
+#define ID_rational dstringt(113, 0)
+#define ID_complex dstringt(114, 0)
+#define ID_signed dstringt(115, 0)
+#define ID_unsigned dstringt(116, 0)
+#define ID_asm dstringt(117, 0)
+#define ID_gcc_asm_input dstringt(118, 0)
+#define ID_gcc_asm_output dstringt(119, 0)
+#define ID_gcc_asm_clobbered_register dstringt(120, 0)
+#define ID_incomplete_array dstringt(121, 0)
+#define ID_incomplete_struct dstringt(122, 0)
+#define ID_incomplete_union dstringt(123, 0)
+#define ID_incomplete_class dstringt(124, 0)
+#define ID_incomplete_c_enum dstringt(125, 0)
+#define ID_C_incomplete dstringt(126, 0) // #incomplete
+#define ID_identifier dstringt(127, 0)
+#define ID_name dstringt(128, 0)
+#define ID_cpp_name dstringt(129, 0)
+#define ID_component_cpp_name dstringt(130, 0)
+#define ID_C_id_class dstringt(131, 0) // #id_class
+#define ID_declaration dstringt(132, 0)
+#define ID_declaration_list dstringt(133, 0)
+#define ID_declarator dstringt(134, 0)
+#define ID_struct dstringt(135, 0)
+#define ID_c_bit_field dstringt(136, 0)
+#define ID_union dstringt(137, 0)
+#define ID_class dstringt(138, 0)
+#define ID_merged_type dstringt(139, 0)
+#define ID_range dstringt(140, 0)
+#define ID_from dstringt(141, 0)
+#define ID_to dstringt(142, 0)
+#define ID_module dstringt(143, 0)
+#define ID_module_instance dstringt(144, 0)
+#define ID_macromodule dstringt(145, 0)
+#define ID_primitive_module_instance dstringt(146, 0)
+#define ID_module_items dstringt(147, 0)
+#define ID_module_source dstringt(148, 0)
+#define ID_parameter_decl dstringt(149, 0)
+#define ID_local_parameter_decl dstringt(150, 0)
+#define ID_parameter dstringt(151, 0)
+#define ID_component_name dstringt(152, 0)
+#define ID_component_number dstringt(153, 0)
+#define ID_tag dstringt(154, 0)
+#define ID_default dstringt(155, 0)
+#define ID_C_default_value dstringt(156, 0) // #default_value
+#define ID_base_name dstringt(157, 0)
+#define ID_C_base_name dstringt(158, 0) // #base_name
+#define ID_string dstringt(159, 0)
+#define ID_C_string_constant dstringt(160, 0) // #string_constant
+#define ID_string_constant dstringt(161, 0)
+#define ID_width dstringt(162, 0)
+#define ID_components dstringt(163, 0)
+#define ID_bv dstringt(164, 0)
+#define ID_f dstringt(165, 0)
+#define ID_ports dstringt(166, 0)
+#define ID_port dstringt(167, 0)
+#define ID_offset dstringt(168, 0)
+#define ID_with dstringt(169, 0)
+#define ID_trans dstringt(170, 0)
+#define ID_throw dstringt(171, 0)
+#define ID_catch dstringt(172, 0)
+#define ID_try_catch dstringt(173, 0)
+#define ID_noexcept dstringt(174, 0)
+#define ID_CPROVER_throw dstringt(175, 0)
+#define ID_CPROVER_try_catch dstringt(176, 0)
+#define ID_CPROVER_try_finally dstringt(177, 0)
+#define ID_protection dstringt(178, 0)
+#define ID_private dstringt(179, 0)
+#define ID_public dstringt(180, 0)
+#define ID_protected dstringt(181, 0)
+#define ID_virtual dstringt(182, 0)
+#define ID_volatile dstringt(183, 0)
+#define ID_const dstringt(184, 0)
+#define ID_constexpr dstringt(185, 0)
+#define ID_inline dstringt(186, 0)
+#define ID_forall dstringt(187, 0)
+#define ID_exists dstringt(188, 0)
+#define ID_forever dstringt(189, 0)
+#define ID_repeat dstringt(190, 0)
+#define ID_extractbit dstringt(191, 0)
+#define ID_extractbits dstringt(192, 0)
+#define ID_reference dstringt(193, 0)
+#define ID_C_reference dstringt(194, 0) // #reference
+#define ID_C_rvalue_reference dstringt(195, 0) // #rvalue_reference
+#define ID_true dstringt(196, 0)
+#define ID_false dstringt(197, 0)
+#define ID_address_of dstringt(198, 0)
+#define ID_dereference dstringt(199, 0)
+#define ID_C_lvalue dstringt(200, 0) // #lvalue
+#define ID_C_base dstringt(201, 0) // #base
+#define ID_destination dstringt(202, 0)
+#define ID_main dstringt(203, 0)
+#define ID_expression dstringt(204, 0)
+#define ID_free dstringt(205, 0)
+#define ID_malloc dstringt(206, 0)
+#define ID_cpp_new dstringt(207, 0)
+#define ID_cpp_delete dstringt(208, 0)
+#define ID_cpp_new_array dstringt(209, 0) // cpp_new[]
+#define ID_cpp_delete_array dstringt(210, 0) // cpp_delete[]
+#define ID_java_new dstringt(211, 0)
+#define ID_java_new_array dstringt(212, 0)
+#define ID_java_string_literal dstringt(213, 0)
+#define ID_printf dstringt(214, 0)
+#define ID_input dstringt(215, 0)
+#define ID_output dstringt(216, 0)
+#define ID_output_register dstringt(217, 0)
+#define ID_inout dstringt(218, 0)
+#define ID_nondet dstringt(219, 0)
+#define ID_NULL dstringt(220, 0)
+#define ID_null dstringt(221, 0)
+#define ID_nullptr dstringt(222, 0)
+#define ID_c_enum dstringt(223, 0)
+#define ID_enumeration dstringt(224, 0)
+#define ID_elements dstringt(225, 0)
+#define ID_unknown dstringt(226, 0)
+#define ID_uninitialized dstringt(227, 0)
+#define ID_invalid dstringt(228, 0)
+#define ID_C_invalid_object dstringt(229, 0) // #invalid_object
+#define ID_pointer_offset dstringt(230, 0)
+#define ID_pointer_object dstringt(231, 0)
+#define ID_invalid_pointer dstringt(232, 0) // invalid-pointer
+#define ID_ieee_float_equal dstringt(233, 0)
+#define ID_ieee_float_notequal dstringt(234, 0)
+#define ID_isnan dstringt(235, 0)
+#define ID_lambda dstringt(236, 0)
+#define ID_array_of dstringt(237, 0)
+#define ID_array_equal dstringt(238, 0)
+#define ID_array_set dstringt(239, 0)
+#define ID_array_copy dstringt(240, 0)
+#define ID_mod dstringt(241, 0)
+#define ID_rem dstringt(242, 0)
+#define ID_shr dstringt(243, 0)
+#define ID_ashr dstringt(244, 0)
+#define ID_lshr dstringt(245, 0)
+#define ID_shl dstringt(246, 0)
+#define ID_rol dstringt(247, 0)
+#define ID_ror dstringt(248, 0)
+#define ID_comma dstringt(249, 0)
+#define ID_concatenation dstringt(250, 0)
+#define ID_infinity dstringt(251, 0)
+#define ID_return_type dstringt(252, 0)
+#define ID_typedef dstringt(253, 0)
+#define ID_extern dstringt(254, 0)
+#define ID_static dstringt(255, 0)
+#define ID_auto dstringt(256, 0)
+#define ID_register dstringt(257, 0)
+#define ID_thread_local dstringt(258, 0)
+#define ID_thread dstringt(259, 0)
+#define ID_C_thread_local dstringt(260, 0) // #thread_local
+#define ID_C_static_lifetime dstringt(261, 0) // #static_lifetime
+#define ID_mutable dstringt(262, 0)
+#define ID_void dstringt(263, 0)
+#define ID_int8 dstringt(264, 0)
+#define ID_int16 dstringt(265, 0)
+#define ID_int32 dstringt(266, 0)
+#define ID_int64 dstringt(267, 0)
+#define ID_ptr32 dstringt(268, 0)
+#define ID_ptr64 dstringt(269, 0)
+#define ID_char dstringt(270, 0)
+#define ID_short dstringt(271, 0)
+#define ID_long dstringt(272, 0)
+#define ID_longlong dstringt(273, 0)
+#define ID_float dstringt(274, 0)
+#define ID_double dstringt(275, 0)
+#define ID_byte dstringt(276, 0)
+#define ID_boolean dstringt(277, 0)
+#define ID_long_double dstringt(278, 0)
+#define ID_signed_char dstringt(279, 0)
+#define ID_unsigned_char dstringt(280, 0)
+#define ID_signed_int dstringt(281, 0)
+#define ID_unsigned_int dstringt(282, 0)
+#define ID_signed_long_int dstringt(283, 0)
+#define ID_unsigned_long_int dstringt(284, 0)
+#define ID_signed_short_int dstringt(285, 0)
+#define ID_unsigned_short_int dstringt(286, 0)
+#define ID_signed_long_long_int dstringt(287, 0)
+#define ID_unsigned_long_long_int dstringt(288, 0)
+#define ID_signed_int128 dstringt(289, 0)
+#define ID_unsigned_int128 dstringt(290, 0)
+#define ID_case dstringt(291, 0)
+#define ID_casex dstringt(292, 0)
+#define ID_casez dstringt(293, 0)
+#define ID_case_item dstringt(294, 0)
+#define ID_C_inlined dstringt(295, 0) // #inlined
+#define ID_C_hide dstringt(296, 0) // #hide
+#define ID_hide dstringt(297, 0)
+#define ID_abs dstringt(298, 0)
+#define ID_sign dstringt(299, 0)
+#define ID_access dstringt(300, 0)
+#define ID_C_access dstringt(301, 0) // #access
+#define ID_postincrement dstringt(302, 0)
+#define ID_postdecrement dstringt(303, 0)
+#define ID_preincrement dstringt(304, 0)
+#define ID_predecrement dstringt(305, 0)
+#define ID_integer_bits dstringt(306, 0)
+#define ID_KnR dstringt(307, 0)
+#define ID_C_KnR dstringt(308, 0) // #KnR
+#define ID_constraint_select_one dstringt(309, 0)
+#define ID_cond dstringt(310, 0)
+#define ID_bv_literals dstringt(311, 0)
+#define ID_isfinite dstringt(312, 0)
+#define ID_isinf dstringt(313, 0)
+#define ID_isnormal dstringt(314, 0)
+#define ID_AG dstringt(315, 0)
+#define ID_AF dstringt(316, 0)
+#define ID_AX dstringt(317, 0)
+#define ID_EG dstringt(318, 0)
+#define ID_EF dstringt(319, 0)
+#define ID_EX dstringt(320, 0)
+#define ID_U dstringt(321, 0)
+#define ID_R dstringt(322, 0)
+#define ID_A dstringt(323, 0)
+#define ID_F dstringt(324, 0)
+#define ID_E dstringt(325, 0)
+#define ID_G dstringt(326, 0)
+#define ID_X dstringt(327, 0)
+#define ID_continuous_assign dstringt(328, 0)
+#define ID_blocking_assign dstringt(329, 0)
+#define ID_non_blocking_assign dstringt(330, 0)
+#define ID_alignof dstringt(331, 0)
+#define ID_gcc_builtin_va_arg dstringt(332, 0)
+#define ID_gcc_builtin_types_compatible_p dstringt(333, 0)
+#define ID_gcc_builtin_va_arg_next dstringt(334, 0)
+#define ID_gcc_builtin_va_list dstringt(335, 0)
+#define ID_gcc_float80 dstringt(336, 0)
+#define ID_gcc_float128 dstringt(337, 0)
+#define ID_gcc_int128 dstringt(338, 0)
+#define ID_gcc_decimal32 dstringt(339, 0)
+#define ID_gcc_decimal64 dstringt(340, 0)
+#define ID_gcc_decimal128 dstringt(341, 0)
+#define ID_builtin_offsetof dstringt(342, 0)
+#define ID_0 dstringt(343, 0)
+#define ID_1 dstringt(344, 0)
+#define ID_8 dstringt(345, 0)
+#define ID_16 dstringt(346, 0)
+#define ID_32 dstringt(347, 0)
+#define ID_64 dstringt(348, 0)
+#define ID_128 dstringt(349, 0)
+#define ID_sizeof dstringt(350, 0)
+#define ID_type_arg dstringt(351, 0)
+#define ID_expr_arg dstringt(352, 0)
+#define ID_expression_list dstringt(353, 0)
+#define ID_initializer_list dstringt(354, 0)
+#define ID_gcc_conditional_expression dstringt(355, 0)
+#define ID_gcc_local_label dstringt(356, 0)
+#define ID_gcc dstringt(357, 0)
+#define ID_msc dstringt(358, 0)
+#define ID_typeof dstringt(359, 0)
+#define ID_ellipsis dstringt(360, 0)
+#define ID_flavor dstringt(361, 0)
+#define ID_ge dstringt(362, 0) // >=
+#define ID_le dstringt(363, 0) // <=
+#define ID_gt dstringt(364, 0) // >
+#define ID_lt dstringt(365, 0) // <
+#define ID_plus dstringt(366, 0) // +
+#define ID_minus dstringt(367, 0) // -
+#define ID_unary_minus dstringt(368, 0) // unary-
+#define ID_unary_plus dstringt(369, 0) // unary+
+#define ID_mult dstringt(370, 0) // *
+#define ID_div dstringt(371, 0) // /
+#define ID_power dstringt(372, 0) // **
+#define ID_factorial_power dstringt(373, 0)
+#define ID_component dstringt(374, 0)
+#define ID_pretty_name dstringt(375, 0)
+#define ID_C_class dstringt(376, 0) // #class
+#define ID_C_interface dstringt(377, 0) // #interface
+#define ID_interface dstringt(378, 0)
+#define ID_targets dstringt(379, 0)
+#define ID_location dstringt(380, 0)
+#define ID_labels dstringt(381, 0)
+#define ID_event dstringt(382, 0)
+#define ID_guard dstringt(383, 0)
+#define ID_designated_initializer dstringt(384, 0)
+#define ID_designator dstringt(385, 0)
+#define ID_member_designator dstringt(386, 0)
+#define ID_index_designator dstringt(387, 0)
+#define ID_offset_designator dstringt(388, 0)
+#define ID_C_constant dstringt(389, 0) // #constant
+#define ID_C_volatile dstringt(390, 0) // #volatile
+#define ID_C_restricted dstringt(391, 0) // #restricted
+#define ID_C_identifier dstringt(392, 0) // #identifier
+#define ID_C_implicit dstringt(393, 0) // #implicit
+#define ID_C_ptr32 dstringt(394, 0) // #ptr32
+#define ID_C_ptr64 dstringt(395, 0) // #ptr64
+#define ID_C_atomic dstringt(396, 0) // #atomic
+#define ID_restrict dstringt(397, 0)
+#define ID_byte_extract_big_endian dstringt(398, 0)
+#define ID_byte_extract_little_endian dstringt(399, 0)
+#define ID_byte_update_big_endian dstringt(400, 0)
+#define ID_byte_update_little_endian dstringt(401, 0)
+#define ID_replication dstringt(402, 0)
+#define ID_dummy dstringt(403, 0)
+#define ID_init dstringt(404, 0)
+#define ID_cprover_atomic dstringt(405, 0)
+#define ID_atomic dstringt(406, 0)
+#define ID_atomic_type_specifier dstringt(407, 0)
+#define ID_atomic_begin dstringt(408, 0)
+#define ID_atomic_end dstringt(409, 0)
+#define ID_start_thread dstringt(410, 0)
+#define ID_end_thread dstringt(411, 0)
+#define ID_specc_notify dstringt(412, 0)
+#define ID_specc_par dstringt(413, 0)
+#define ID_specc_wait dstringt(414, 0)
+#define ID_specc_event dstringt(415, 0)
+#define ID_bp_enforce dstringt(416, 0)
+#define ID_bp_abortif dstringt(417, 0)
+#define ID_bp_constrain dstringt(418, 0)
+#define ID_bp_schoose dstringt(419, 0)
+#define ID_bp_dead dstringt(420, 0)
+#define ID_instance dstringt(421, 0)
+#define ID_cover dstringt(422, 0)
+#define ID_coverage_criterion dstringt(423, 0)
+#define ID_initializer dstringt(424, 0)
+#define ID_anonymous dstringt(425, 0)
+#define ID_C_is_anonymous dstringt(426, 0) // #is_anonymous
+#define ID_is_macro dstringt(427, 0)
+#define ID_is_enum_constant dstringt(428, 0)
+#define ID_is_inline dstringt(429, 0)
+#define ID_is_extern dstringt(430, 0)
+#define ID_is_global dstringt(431, 0)
+#define ID_is_thread_local dstringt(432, 0)
+#define ID_is_parameter dstringt(433, 0)
+#define ID_is_member dstringt(434, 0)
+#define ID_is_type dstringt(435, 0)
+#define ID_is_register dstringt(436, 0)
+#define ID_is_typedef dstringt(437, 0)
+#define ID_is_static dstringt(438, 0)
+#define ID_is_template dstringt(439, 0)
+#define ID_is_static_assert dstringt(440, 0)
+#define ID_is_virtual dstringt(441, 0)
+#define ID_C_is_virtual dstringt(442, 0) // #is_virtual
+#define ID_literal dstringt(443, 0)
+#define ID_member_initializers dstringt(444, 0)
+#define ID_member_initializer dstringt(445, 0)
+#define ID_method_qualifier dstringt(446, 0)
+#define ID_methods dstringt(447, 0)
+#define ID_constructor dstringt(448, 0)
+#define ID_destructor dstringt(449, 0)
+#define ID_bases dstringt(450, 0)
+#define ID_base dstringt(451, 0)
+#define ID_from_base dstringt(452, 0)
+#define ID_operator dstringt(453, 0)
+#define ID_template dstringt(454, 0)
+#define ID_template_class_instance dstringt(455, 0)
+#define ID_template_function_instance dstringt(456, 0)
+#define ID_template_type dstringt(457, 0)
+#define ID_template_args dstringt(458, 0)
+#define ID_template_parameter dstringt(459, 0)
+#define ID_template_parameters dstringt(460, 0)
+#define ID_C_template dstringt(461, 0) // #template
+#define ID_C_template_arguments dstringt(462, 0) // #template_arguments
+#define ID_typename dstringt(463, 0)
+#define ID_C dstringt(464, 0)
+#define ID_cpp dstringt(465, 0)
+#define ID_java dstringt(466, 0)
+#define ID_SpecC dstringt(467, 0)
+#define ID_SystemC dstringt(468, 0)
+#define ID_decl_block dstringt(469, 0)
+#define ID_decl_type dstringt(470, 0)
+#define ID_genvar dstringt(471, 0)
+#define ID_realtime dstringt(472, 0)
+#define ID_parameters dstringt(473, 0)
+#define ID_parameter_assignments dstringt(474, 0)
+#define ID_named_parameter_assignment dstringt(475, 0)
+#define ID_specify dstringt(476, 0)
+#define ID_pullup dstringt(477, 0)
+#define ID_pulldown dstringt(478, 0)
+#define ID_automatic dstringt(479, 0)
+#define ID_rcmos dstringt(480, 0)
+#define ID_cmos dstringt(481, 0)
+#define ID_nmos dstringt(482, 0)
+#define ID_pmos dstringt(483, 0)
+#define ID_rnmos dstringt(484, 0)
+#define ID_rpmos dstringt(485, 0)
+#define ID_wchar_t dstringt(486, 0)
+#define ID_char16_t dstringt(487, 0)
+#define ID_char32_t dstringt(488, 0)
+#define ID_size_t dstringt(489, 0)
+#define ID_ssize_t dstringt(490, 0)
+#define ID_inst dstringt(491, 0)
+#define ID_inst_builtin dstringt(492, 0)
+#define ID_always dstringt(493, 0)
+#define ID_initial dstringt(494, 0)
+#define ID_mode dstringt(495, 0)
+#define ID_this dstringt(496, 0)
+#define ID_C_this dstringt(497, 0) // #this
+#define ID_reduction_and dstringt(498, 0)
+#define ID_reduction_or dstringt(499, 0)
+#define ID_reduction_nand dstringt(500, 0)
+#define ID_reduction_nor dstringt(501, 0)
+#define ID_reduction_xor dstringt(502, 0)
+#define ID_reduction_xnor dstringt(503, 0)
+#define ID_C_zero_initializer dstringt(504, 0) // #zero_initializer
+#define ID_body dstringt(505, 0)
+#define ID_entity dstringt(506, 0)
+#define ID_temporary_object dstringt(507, 0)
+#define ID_overflow_plus dstringt(508, 0) // overflow-+
+#define ID_overflow_minus dstringt(509, 0) // overflow--
+#define ID_overflow_mult dstringt(510, 0) // overflow-*
+#define ID_overflow_unary_minus dstringt(511, 0) // overflow-unary-
+#define ID_object_descriptor dstringt(512, 0)
+#define ID_dynamic_object dstringt(513, 0)
+#define ID_object_size dstringt(514, 0)
+#define ID_good_pointer dstringt(515, 0)
+#define ID_integer_address dstringt(516, 0)
+#define ID_integer_address_object dstringt(517, 0)
+#define ID_null_object dstringt(518, 0)
+#define ID_static_object dstringt(519, 0)
+#define ID_stack_object dstringt(520, 0)
+#define ID_C_is_failed_symbol dstringt(521, 0) // #is_failed_symbol
+#define ID_C_failed_symbol dstringt(522, 0) // #failed_symbol
+#define ID_list dstringt(523, 0)
+#define ID_map dstringt(524, 0)
+#define ID_set dstringt(525, 0)
+#define ID_storage dstringt(526, 0)
+#define ID_friend dstringt(527, 0)
+#define ID_explicit dstringt(528, 0)
+#define ID_storage_spec dstringt(529, 0)
+#define ID_member_spec dstringt(530, 0)
+#define ID_msc_declspec dstringt(531, 0)
+#define ID_packed dstringt(532, 0)
+#define ID_C_packed dstringt(533, 0) // #packed
+#define ID_transparent_union dstringt(534, 0)
+#define ID_C_transparent_union dstringt(535, 0) // #transparent_union
+#define ID_aligned dstringt(536, 0)
+#define ID_C_alignment dstringt(537, 0) // #alignment
+#define ID_vector dstringt(538, 0)
+#define ID_abstract dstringt(539, 0)
+#define ID_bit dstringt(540, 0)
+#define ID_logic dstringt(541, 0)
+#define ID_chandle dstringt(542, 0)
+#define ID_reg dstringt(543, 0)
+#define ID_wire dstringt(544, 0)
+#define ID_tri dstringt(545, 0)
+#define ID_tri1 dstringt(546, 0)
+#define ID_supply0 dstringt(547, 0)
+#define ID_wand dstringt(548, 0)
+#define ID_triand dstringt(549, 0)
+#define ID_tri0 dstringt(550, 0)
+#define ID_supply1 dstringt(551, 0)
+#define ID_wor dstringt(552, 0)
+#define ID_trior dstringt(553, 0)
+#define ID_trireg dstringt(554, 0)
+#define ID_function_application dstringt(555, 0)
+#define ID_cpp_declarator dstringt(556, 0)
+#define ID_cpp_linkage_spec dstringt(557, 0)
+#define ID_cpp_namespace_spec dstringt(558, 0)
+#define ID_cpp_storage_spec dstringt(559, 0)
+#define ID_cpp_using dstringt(560, 0)
+#define ID_cpp_declaration dstringt(561, 0)
+#define ID_cpp_static_assert dstringt(562, 0)
+#define ID_cpp_member_spec dstringt(563, 0)
+#define ID_C_c_type dstringt(564, 0) // #c_type
+#define ID_namespace dstringt(565, 0)
+#define ID_linkage dstringt(566, 0)
+#define ID_decltype dstringt(567, 0)
+#define ID_buf dstringt(568, 0)
+#define ID_bufif0 dstringt(569, 0)
+#define ID_bufif1 dstringt(570, 0)
+#define ID_notif0 dstringt(571, 0)
+#define ID_notif1 dstringt(572, 0)
+#define ID_task dstringt(573, 0)
+#define ID_C_little_endian dstringt(574, 0) // #little_endian
+#define ID_C_offset dstringt(575, 0) // #offset
+#define ID_C_tag_only_declaration dstringt(576, 0) // #tag_only_declaration
+#define ID_struct_tag dstringt(577, 0)
+#define ID_union_tag dstringt(578, 0)
+#define ID_c_enum_tag dstringt(579, 0)
+#define ID_enum_constant dstringt(580, 0)
+#define ID_bit_select dstringt(581, 0)
+#define ID_part_select dstringt(582, 0)
+#define ID_indexed_part_select_plus dstringt(583, 0)
+#define ID_indexed_part_select_minus dstringt(584, 0)
+#define ID_generate_block dstringt(585, 0)
+#define ID_generate_assign dstringt(586, 0)
+#define ID_generate_skip dstringt(587, 0)
+#define ID_generate_case dstringt(588, 0)
+#define ID_generate_if dstringt(589, 0)
+#define ID_generate_for dstringt(590, 0)
+#define ID_delay dstringt(591, 0)
+#define ID_verilog_cycle_delay dstringt(592, 0)
+#define ID_sva_cycle_delay dstringt(593, 0)
+#define ID_sva_sequence_throughout dstringt(594, 0)
+#define ID_sva_sequence_concatenation dstringt(595, 0)
+#define ID_sva_sequence_first_match dstringt(596, 0)
+#define ID_sva_always dstringt(597, 0)
+#define ID_sva_nexttime dstringt(598, 0)
+#define ID_sva_s_nexttime dstringt(599, 0)
+#define ID_sva_eventually dstringt(600, 0)
+#define ID_sva_s_eventually dstringt(601, 0)
+#define ID_sva_until dstringt(602, 0)
+#define ID_sva_s_until dstringt(603, 0)
+#define ID_sva_until_with dstringt(604, 0)
+#define ID_sva_s_until_with dstringt(605, 0)
+#define ID_sva_overlapped_implication dstringt(606, 0)
+#define ID_sva_non_overlapped_implication dstringt(607, 0)
+#define ID_hierarchical_identifier dstringt(608, 0)
+#define ID_named_port_connection dstringt(609, 0)
+#define ID_named_block dstringt(610, 0)
+#define ID_verilog_primitive_module dstringt(611, 0)
+#define ID_verilog_module dstringt(612, 0)
+#define ID_verilog_case_equality dstringt(613, 0)
+#define ID_verilog_case_inequality dstringt(614, 0)
+#define ID_event_guard dstringt(615, 0)
+#define ID_posedge dstringt(616, 0)
+#define ID_negedge dstringt(617, 0)
+#define ID_pointer_and_address_pair dstringt(618, 0)
+#define ID_user_specified_predicate dstringt(619, 0)
+#define ID_user_specified_parameter_predicates dstringt(620, 0)
+#define ID_user_specified_return_predicates dstringt(621, 0)
+#define ID_unassigned dstringt(622, 0)
+#define ID_new_object dstringt(623, 0)
+#define ID_complex_real dstringt(624, 0)
+#define ID_complex_imag dstringt(625, 0)
+#define ID_imag dstringt(626, 0)
+#define ID_msc_try_except dstringt(627, 0)
+#define ID_msc_try_finally dstringt(628, 0)
+#define ID_msc_leave dstringt(629, 0)
+#define ID_msc_uuidof dstringt(630, 0)
+#define ID_msc_if_exists dstringt(631, 0)
+#define ID_msc_if_not_exists dstringt(632, 0)
+#define ID_msc_underlying_type dstringt(633, 0)
+#define ID_msc_based dstringt(634, 0)
+#define ID_alias dstringt(635, 0)
+#define ID_auto_object dstringt(636, 0)
+#define ID_ssa_object dstringt(637, 0)
+#define ID_ptr_object dstringt(638, 0)
+#define ID_C_c_sizeof_type dstringt(639, 0) // #c_sizeof_type
+#define ID_array_update dstringt(640, 0)
+#define ID_struct_update dstringt(641, 0)
+#define ID_union_update dstringt(642, 0)
+#define ID_update dstringt(643, 0)
+#define ID_float_debug1 dstringt(644, 0)
+#define ID_float_debug2 dstringt(645, 0)
+#define ID_static_assert dstringt(646, 0)
+#define ID_gcc_attribute_mode dstringt(647, 0)
+#define ID_built_in dstringt(648, 0) // <built-in>
+#define ID_exception_list dstringt(649, 0)
+#define ID_exception_id dstringt(650, 0)
+#define ID_priority dstringt(651, 0)
+#define ID_predicate_passive_symbol dstringt(652, 0)
+#define ID_all dstringt(653, 0)
+#define ID_when dstringt(654, 0)
+#define ID_cw_va_arg_typeof dstringt(655, 0)
+#define ID_fence dstringt(656, 0)
+#define ID_sync dstringt(657, 0)
+#define ID_lwsync dstringt(658, 0)
+#define ID_isync dstringt(659, 0)
+#define ID_WRfence dstringt(660, 0)
+#define ID_RRfence dstringt(661, 0)
+#define ID_RWfence dstringt(662, 0)
+#define ID_WWfence dstringt(663, 0)
+#define ID_RRcumul dstringt(664, 0)
+#define ID_RWcumul dstringt(665, 0)
+#define ID_WWcumul dstringt(666, 0)
+#define ID_WRcumul dstringt(667, 0)
+#define ID_claim dstringt(668, 0)
+#define ID_generic_selection dstringt(669, 0)
+#define ID_generic_associations dstringt(670, 0)
+#define ID_generic_association dstringt(671, 0)
+#define ID_floatbv_plus dstringt(672, 0)
+#define ID_floatbv_minus dstringt(673, 0)
+#define ID_floatbv_mult dstringt(674, 0)
+#define ID_floatbv_div dstringt(675, 0)
+#define ID_floatbv_rem dstringt(676, 0)
+#define ID_floatbv_sin dstringt(677, 0)
+#define ID_floatbv_cos dstringt(678, 0)
+#define ID_floatbv_typecast dstringt(679, 0)
+#define ID_read dstringt(680, 0)
+#define ID_write dstringt(681, 0)
+#define ID_native dstringt(682, 0)
+#define ID_final dstringt(683, 0)
+#define ID__start dstringt(684, 0)
+#define ID_compound_literal dstringt(685, 0)
+#define ID_custom_bv dstringt(686, 0)
+#define ID_custom_unsignedbv dstringt(687, 0)
+#define ID_custom_signedbv dstringt(688, 0)
+#define ID_custom_fixedbv dstringt(689, 0)
+#define ID_custom_floatbv dstringt(690, 0)
+#define ID_C_SSA_symbol dstringt(691, 0) // #SSA_symbol
+#define ID_C_full_identifier dstringt(692, 0) // #full_identifier
+#define ID_L0 dstringt(693, 0)
+#define ID_L1 dstringt(694, 0)
+#define ID_L2 dstringt(695, 0)
+#define ID_L1_object_identifier dstringt(696, 0)
+#define ID_already_typechecked dstringt(697, 0)
+#define ID_C_va_arg_type dstringt(698, 0) // #va_arg_type
+#define ID_smt2_symbol dstringt(699, 0)
+#define ID_VHDL dstringt(700, 0)
+#define ID_Verilog dstringt(701, 0)
+#define ID_verilog_realtime dstringt(702, 0)
+#define ID_onehot dstringt(703, 0)
+#define ID_onehot0 dstringt(704, 0)
+#define ID_verilog_star_event dstringt(705, 0)
+#define ID_verilog_attribute dstringt(706, 0)
+#define ID_time dstringt(707, 0)
+#define ID_fork dstringt(708, 0)
+#define ID_disable dstringt(709, 0)
+#define ID_wait dstringt(710, 0)
+#define ID_deassign dstringt(711, 0)
+#define ID_force dstringt(712, 0)
+#define ID_release dstringt(713, 0)
+#define ID_popcount dstringt(714, 0)
+#define ID_function_type dstringt(715, 0)
+#define ID_noreturn dstringt(716, 0)
+#define ID_C_noreturn dstringt(717, 0) // #noreturn
+#define ID_process dstringt(718, 0)
+#define ID_signal dstringt(719, 0)
+#define ID_weak dstringt(720, 0)
+#define ID_is_weak dstringt(721, 0)
+#define ID_C_spec_loop_invariant dstringt(722, 0) // #spec_loop_invariant
+#define ID_C_spec_requires dstringt(723, 0) // #spec_requires
+#define ID_C_spec_ensures dstringt(724, 0) // #spec_ensures
+#define ID_virtual_function dstringt(725, 0)
+#define ID_C_element_type dstringt(726, 0) // #element_type
+#define ID_working_directory dstringt(727, 0)
+#define ID_section dstringt(728, 0)
+#define ID_msb dstringt(729, 0)
+#define ID_lsb dstringt(730, 0)
+#define ID_verilog_signed_vector dstringt(731, 0)
+#define ID_verilog_unsigned_vector dstringt(732, 0)
+#define ID_verilog_array dstringt(733, 0)
+#define ID_low dstringt(734, 0)
+#define ID_high dstringt(735, 0)
+#define ID_bswap dstringt(736, 0)
+#define ID_java_bytecode_index dstringt(737, 0)
+#define ID_java_instanceof dstringt(738, 0)
+#define ID_java_super_method_call dstringt(739, 0)
+#define ID_java_enum_static_unwind dstringt(740, 0)
+#define ID_string_constraint dstringt(741, 0)
+#define ID_string_not_contains_constraint dstringt(742, 0)
+#define ID_cprover_char_literal_func dstringt(743, 0)
+#define ID_cprover_string_literal_func dstringt(744, 0)
+#define ID_cprover_string_char_at_func dstringt(745, 0)
+#define ID_cprover_string_char_set_func dstringt(746, 0)
+#define ID_cprover_string_code_point_at_func dstringt(747, 0)
+#define ID_cprover_string_code_point_before_func dstringt(748, 0)
+#define ID_cprover_string_code_point_count_func dstringt(749, 0)
+#define ID_cprover_string_offset_by_code_point_func dstringt(750, 0)
+#define ID_cprover_string_compare_to_func dstringt(751, 0)
+#define ID_cprover_string_concat_func dstringt(752, 0)
+#define ID_cprover_string_concat_int_func dstringt(753, 0)
+#define ID_cprover_string_concat_long_func dstringt(754, 0)
+#define ID_cprover_string_concat_char_func dstringt(755, 0)
+#define ID_cprover_string_concat_bool_func dstringt(756, 0)
+#define ID_cprover_string_concat_double_func dstringt(757, 0)
+#define ID_cprover_string_concat_float_func dstringt(758, 0)
+#define ID_cprover_string_concat_code_point_func dstringt(759, 0)
+#define ID_cprover_string_contains_func dstringt(760, 0)
+#define ID_cprover_string_copy_func dstringt(761, 0)
+#define ID_cprover_string_delete_func dstringt(762, 0)
+#define ID_cprover_string_delete_char_at_func dstringt(763, 0)
+#define ID_cprover_string_equal_func dstringt(764, 0)
+#define ID_cprover_string_equals_ignore_case_func dstringt(765, 0)
+#define ID_cprover_string_empty_string_func dstringt(766, 0)
+#define ID_cprover_string_endswith_func dstringt(767, 0)
+#define ID_cprover_string_format_func dstringt(768, 0)
+#define ID_cprover_string_hash_code_func dstringt(769, 0)
+#define ID_cprover_string_index_of_func dstringt(770, 0)
+#define ID_cprover_string_intern_func dstringt(771, 0)
+#define ID_cprover_string_insert_func dstringt(772, 0)
+#define ID_cprover_string_insert_int_func dstringt(773, 0)
+#define ID_cprover_string_insert_long_func dstringt(774, 0)
+#define ID_cprover_string_insert_bool_func dstringt(775, 0)
+#define ID_cprover_string_insert_char_func dstringt(776, 0)
+#define ID_cprover_string_insert_float_func dstringt(777, 0)
+#define ID_cprover_string_insert_double_func dstringt(778, 0)
+#define ID_cprover_string_insert_char_array_func dstringt(779, 0)
+#define ID_cprover_string_is_prefix_func dstringt(780, 0)
+#define ID_cprover_string_is_suffix_func dstringt(781, 0)
+#define ID_cprover_string_is_empty_func dstringt(782, 0)
+#define ID_cprover_string_last_index_of_func dstringt(783, 0)
+#define ID_cprover_string_length_func dstringt(784, 0)
+#define ID_cprover_string_data_func dstringt(785, 0)
+#define ID_cprover_string_of_int_func dstringt(786, 0)
+#define ID_cprover_string_of_int_hex_func dstringt(787, 0)
+#define ID_cprover_string_of_long_func dstringt(788, 0)
+#define ID_cprover_string_of_bool_func dstringt(789, 0)
+#define ID_cprover_string_of_float_func dstringt(790, 0)
+#define ID_cprover_string_of_double_func dstringt(791, 0)
+#define ID_cprover_string_of_char_func dstringt(792, 0)
+#define ID_cprover_string_of_char_array_func dstringt(793, 0)
+#define ID_cprover_string_parse_int_func dstringt(794, 0)
+#define ID_cprover_string_replace_func dstringt(795, 0)
+#define ID_cprover_string_set_length_func dstringt(796, 0)
+#define ID_cprover_string_startswith_func dstringt(797, 0)
+#define ID_cprover_string_substring_func dstringt(798, 0)
+#define ID_cprover_string_to_char_array_func dstringt(799, 0)
+#define ID_cprover_string_to_lower_case_func dstringt(800, 0)
+#define ID_cprover_string_to_upper_case_func dstringt(801, 0)
+#define ID_cprover_string_trim_func dstringt(802, 0)
+#define ID_cprover_string_value_of_func dstringt(803, 0)
+
+#endif
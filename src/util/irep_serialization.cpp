@@ -327,7 +327,8 @@ irep_idt irep_serializationt::read_gb_string(std::istream &in)
   char c;
   size_t length=0;
 
-  while((c = in.get()) != 0)
+  // a truncated string ends the stream, with failbit set
+  while((c = in.get()) != 0 && in.good())
   {
     if(length>=read_buffer.size())
       read_buffer.resize(read_buffer.size()*2, 0);
@@ -38,6 +38,15 @@ public:
     std::istream &instream,
     const std::string &path)=0;
 
+  // parse what preprocess produced, without preprocessing again
+
+  virtual bool parse_preprocessed(
+    std::istream &instream,
+    const std::string &path)
+  {
+    return parse(instream, path);
+  }
+
   // add external dependencies of a given module to set
 
   virtual void dependencies(
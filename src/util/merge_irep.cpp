@@ -67,9 +67,9 @@ bool to_be_merged_irept::operator == (const to_be_merged_irept &other) const
   const irept::named_subt &o_named_sub=other.get_named_sub();
 
   if(sub.size()!=o_sub.size())
-    return true;
+    return false;
   if(named_sub.size()!=o_named_sub.size())
-    return true;
+    return false;
 
   {
     irept::subt::const_iterator s_it=sub.begin();
@@ -97,6 +97,119 @@ bool to_be_merged_irept::operator == (const to_be_merged_irept &other) const
 
 /*******************************************************************\
 
+Function: to_be_full_merged_irept::hash
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+std::size_t to_be_full_merged_irept::hash() const
+{
+  std::size_t result=hash_string(id());
+
+  const irept::subt &sub=get_sub();
+  const irept::named_subt &named_sub=get_named_sub();
+  const irept::named_subt &comments=get_comments();
+
+  forall_irep(it, sub)
+    result=hash_combine(result, static_cast<const merged_irept &>(*it).hash());
+
+  forall_named_irep(it, named_sub)
+  {
+    result=hash_combine(result, hash_string(it->first));
+    result=
+      hash_combine(
+        result, static_cast<const merged_irept &>(it->second).hash());
+  }
+
+  forall_named_irep(it, comments)
+  {
+    result=hash_combine(result, hash_string(it->first));
+    result=
+      hash_combine(
+        result, static_cast<const merged_irept &>(it->second).hash());
+  }
+
+  result=hash_finalize(result, named_sub.size()+sub.size()+comments.size());
+
+  return result;
+}
+
+/*******************************************************************\
+
+Function: same_children
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: compares maps of merged children
+
+\*******************************************************************/
+
+static bool same_children(
+  const irept::named_subt &named_sub,
+  const irept::named_subt &o_named_sub)
+{
+  if(named_sub.size()!=o_named_sub.size())
+    return false;
+
+  irept::named_subt::const_iterator s_it=named_sub.begin();
+  irept::named_subt::const_iterator os_it=o_named_sub.begin();
+
+  for(; s_it!=named_sub.end(); s_it++, os_it++)
+    if(s_it->first!=os_it->first ||
+       static_cast<const merged_irept &>(s_it->second)!=
+       static_cast<const merged_irept &>(os_it->second))
+      return false;
+
+  return true;
+}
+
+/*******************************************************************\
+
+Function: to_be_full_merged_irept::operator==
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bool to_be_full_merged_irept::operator==(
+  const to_be_full_merged_irept &other) const
+{
+  if(id()!=other.id())
+    return false;
+
+  const irept::subt &sub=get_sub();
+  const irept::subt &o_sub=other.get_sub();
+
+  if(sub.size()!=o_sub.size())
+    return false;
+
+  {
+    irept::subt::const_iterator s_it=sub.begin();
+    irept::subt::const_iterator os_it=o_sub.begin();
+
+    for(; s_it!=sub.end(); s_it++, os_it++)
+      if(static_cast<const merged_irept &>(*s_it)!=
+         static_cast<const merged_irept &>(*os_it))
+        return false;
+  }
+
+  return same_children(get_named_sub(), other.get_named_sub()) &&
+         same_children(get_comments(), other.get_comments());
+}
+
+/*******************************************************************\
+
 Function: merged_irepst::merged
 
   Inputs:
@@ -255,7 +368,9 @@ Function: merge_full_irept::merged
 
 const irept &merge_full_irept::merged(const irept &irep)
 {
-  irep_storet::const_iterator entry=irep_store.find(irep);
+  // the children of a merged irep are merged, too
+  irep_storet::const_iterator entry=
+    irep_store.find(to_be_full_merged_irept(irep));
   if(entry!=irep_store.end())
     return *entry;
 
@@ -290,5 +405,5 @@ const irept &merge_full_irept::merged(const irept &irep)
     dest_comments[it->first]=merged(it->second); // recursive call
     #endif
 
-  return *irep_store.insert(new_irep).first;
+  return *irep_store.insert(to_be_full_merged_irept(new_irep)).first;
 }
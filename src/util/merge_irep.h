@@ -110,13 +110,70 @@ protected:
   const irept &merged(const irept &irep);
 };
 
+// hash and compare ireps merged by merge_full_irept by the identity
+// of their nodes
+
+// NOLINTNEXTLINE(readability/identifiers)
+struct merged_full_irep_hash
+{
+  std::size_t operator()(const irept &irep) const
+  { return static_cast<const merged_irept &>(irep).hash(); }
+};
+
+// NOLINTNEXTLINE(readability/identifiers)
+struct merged_full_irep_eq
+{
+  bool operator()(const irept &i1, const irept &i2) const
+  {
+    return static_cast<const merged_irept &>(i1)==
+           static_cast<const merged_irept &>(i2);
+  }
+};
+
+// internal, don't use me
+class to_be_full_merged_irept:public irept
+{
+public:
+  bool operator==(const to_be_full_merged_irept &other) const;
+  std::size_t hash() const;
+
+protected:
+  // can only be used by merge_full_irept
+  explicit to_be_full_merged_irept(const irept &src):irept(src)
+  {
+  }
+
+  friend class merge_full_irept;
+};
+
+// NOLINTNEXTLINE(readability/identifiers)
+struct to_be_full_merged_irep_hash
+{
+  std::size_t operator()(const to_be_full_merged_irept &irep) const
+  { return irep.hash(); }
+};
+
+// Hash-consing: every distinct irep, including its comments, is kept
+// once, and ireps merged by the same merge_full_irept are full_eq iff
+// they are the same node. The nodes are compared and hashed by the
+// identity of their children, which are merged first, and an irep
+// that is merged already is found without walking it. The store keeps
+// the nodes shared, and thus unchanged; this also makes hash() store
+// their hash codes.
+
 class merge_full_irept
 {
 public:
   void operator()(irept &);
 
+  void clear()
+  {
+    irep_store.clear();
+  }
+
 protected:
-  typedef std::unordered_set<irept, irep_full_hash, irep_full_eq> irep_storet;
+  typedef std::unordered_set<
+    to_be_full_merged_irept, to_be_full_merged_irep_hash> irep_storet;
   irep_storet irep_store;
 
   const irept &merged(const irept &irep);
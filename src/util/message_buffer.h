@@ -0,0 +1,100 @@
+/*******************************************************************\
+
+Module: Buffering Messages
+
+Author:
+
+\*******************************************************************/
+
+#ifndef CPROVER_UTIL_MESSAGE_BUFFER_H
+#define CPROVER_UTIL_MESSAGE_BUFFER_H
+
+#include <string>
+#include <vector>
+
+#include "irep_serialization.h"
+#include "message.h"
+#include "source_location.h"
+
+/*******************************************************************\
+
+   Class: message_buffert
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: keeps the messages of a worker process, such that
+          they can be passed on by the parent
+
+\*******************************************************************/
+
+class message_buffert:public message_handlert
+{
+public:
+  virtual void print(unsigned level, const std::string &message)
+  {
+    print(level, message, -1, source_locationt());
+  }
+
+  virtual void print(
+    unsigned level,
+    const std::string &message,
+    int sequence_number,
+    const source_locationt &location)
+  {
+    messages.push_back(entryt());
+    messages.back().level=level;
+    messages.back().message=message;
+    messages.back().sequence_number=sequence_number;
+    messages.back().location=location;
+  }
+
+  void write(std::ostream &out, irep_serializationt &irepconverter) const
+  {
+    write_gb_word(out, messages.size());
+
+    for(const auto &m : messages)
+    {
+      write_gb_word(out, m.level);
+      write_gb_word(out, m.sequence_number+1);
+      write_gb_string(out, m.message);
+      irepconverter.reference_convert(m.location, out);
+    }
+  }
+
+  void read(std::istream &in, irep_serializationt &irepconverter)
+  {
+    std::size_t count=irepconverter.read_gb_word(in);
+
+    for(std::size_t i=0; i<count && in; i++)
+    {
+      messages.push_back(entryt());
+      messages.back().level=irepconverter.read_gb_word(in);
+      messages.back().sequence_number=
+        static_cast<int>(irepconverter.read_gb_word(in))-1;
+      messages.back().message=id2string(irepconverter.read_gb_string(in));
+      irepconverter.reference_convert(in, messages.back().location);
+    }
+  }
+
+  void replay(message_handlert &message_handler) const
+  {
+    for(const auto &m : messages)
+      message_handler.print(
+        m.level, m.message, m.sequence_number, m.location);
+  }
+
+protected:
+  struct entryt
+  {
+    unsigned level;
+    std::string message;
+    int sequence_number;
+    source_locationt location;
+  };
+
+  std::vector<entryt> messages;
+};
+
+#endif // CPROVER_UTIL_MESSAGE_BUFFER_H
@@ -147,8 +147,32 @@ int pipe_streamt::run()
 
 #else
 
+/*******************************************************************\
+
+Function: ignore_sigpipe
+
+  Inputs:
+
+ Outputs: true
+
+ Purpose: Makes writing to a process that has terminated fail,
+          instead of terminating us with SIGPIPE. This is done once,
+          before the first process is started, as changing the
+          handler races with other threads.
+
+\*******************************************************************/
+
+static bool ignore_sigpipe()
+{
+  signal(SIGPIPE, SIG_IGN);
+  return true;
+}
+
 int pipe_streamt::run()
 {
+  static const bool sigpipe_ignored=ignore_sigpipe();
+  (void)sigpipe_ignored;
+
   filedescriptor_streambuft::HANDLE in[2], out[2];
 
   if(pipe(in)==-1 || pipe(out)==-1)
@@ -158,7 +182,8 @@ int pipe_streamt::run()
 
   if(pid==0)
   {
-    // child
+    // child, which gets the default handler back
+    signal(SIGPIPE, SIG_DFL);
     close(in[1]);
     close(out[0]);
     dup2(in[0], STDIN_FILENO);
@@ -178,12 +203,12 @@ int pipe_streamt::run()
 
     _argv[args.size()+1]=NULL;
 
-    int result=execvp(executable.c_str(), _argv);
-
-    if(result==-1)
-      perror(0);
+    execvp(executable.c_str(), _argv);
 
-    return result;
+    // only reached if execvp failed; the child must not return
+    // into the code of the parent
+    perror(executable.c_str());
+    _exit(1);
   }
   else if(pid==-1)
   {
@@ -354,7 +379,8 @@ std::streamsize filedescriptor_streambuft::xsputn(
   WriteFile(proc_in, str, (DWORD)count, &len, NULL);
   return len;
 #else
-  return write(proc_in, str, count);
+  ssize_t len=write(proc_in, str, count);
+  return len<0?0:len;
 #endif
 }
 
@@ -9,7 +9,7 @@ Author:
 #ifndef CPROVER_UTIL_PIPE_STREAM_H
 #define CPROVER_UTIL_PIPE_STREAM_H
 
-#include <iosfwd>
+#include <iostream>
 #include <string>
 #include <list>
 
@@ -44,12 +44,19 @@ public:
 
   void operator()(exprt &dest) const
   {
-    rename(dest);
+    if(!empty())
+      rename(dest);
   }
 
   void operator()(typet &dest) const
   {
-    rename(dest);
+    if(!empty())
+      rename(dest);
+  }
+
+  bool empty() const
+  {
+    return expr_map.empty() && type_map.empty();
   }
 
   rename_symbolt();
@@ -58,12 +65,13 @@ public:
   expr_mapt expr_map;
   type_mapt type_map;
 
+  // false if the renaming leaves dest unchanged
+  bool have_to_rename(const exprt &dest) const;
+  bool have_to_rename(const typet &type) const;
+
 protected:
   bool rename(exprt &dest) const;
   bool rename(typet &dest) const;
-
-  bool have_to_rename(const exprt &dest) const;
-  bool have_to_rename(const typet &type) const;
 };
 
 #endif // CPROVER_UTIL_RENAME_SYMBOL_H
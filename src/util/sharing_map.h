@@ -0,0 +1,729 @@
+/*******************************************************************\
+
+Module: Maps with Sharing
+
+Author:
+
+\*******************************************************************/
+
+#ifndef CPROVER_UTIL_SHARING_MAP_H
+#define CPROVER_UTIL_SHARING_MAP_H
+
+#include <bitset>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+/*! \brief A hash map whose copies share their unchanged parts
+
+  The entries are kept in a trie over the bits of the hash of their
+  key (a hash array mapped trie), and the nodes of the trie are
+  reference counted. Copying a map is thus constant time, and
+  changing an entry only copies the nodes on the path to it that are
+  shared with another map.
+
+  Two maps that stem from a common ancestor share the nodes that
+  neither has changed; get_delta_view only visits the others, which
+  is what makes merging such maps cheap.
+
+  The references returned by the modifying operations are valid
+  until the next modification of the map; as the map is copied
+  lazily, they must not be used after copying the map either.
+*/
+template<
+  class keyT,
+  class valueT,
+  class hashT=std::hash<keyT>,
+  class equalT=std::equal_to<keyT> >
+class sharing_mapt
+{
+public:
+  typedef keyT key_type;
+  typedef valueT mapped_type;
+  typedef std::pair<keyT, valueT> value_type;
+  typedef std::size_t size_type;
+
+protected:
+  // bits of the hash per level of the trie
+  static const unsigned bits=5;
+  static const unsigned children_per_node=1u<<bits;
+  static const unsigned levels=(sizeof(std::size_t)*8+bits-1)/bits;
+
+  // leaves with more entries are split, unless at the last level
+  static const std::size_t leaf_size=8;
+
+  class nodet
+  {
+  public:
+    nodet():ref_count(1), bitmap(0)
+    {
+    }
+
+    nodet(const nodet &other):
+      ref_count(1),
+      bitmap(other.bitmap),
+      children(other.children),
+      entries(other.entries)
+    {
+      for(typename childrent::const_iterator
+          it=children.begin();
+          it!=children.end();
+          it++)
+        (*it)->ref_count++;
+    }
+
+    ~nodet()
+    {
+      for(typename childrent::const_iterator
+          it=children.begin();
+          it!=children.end();
+          it++)
+        remove_ref(*it);
+    }
+
+    // a node without children is a leaf, which may hold entries
+    bool is_leaf() const
+    {
+      return bitmap==0;
+    }
+
+    unsigned ref_count;
+
+    // the children that exist, by the bits of the hash that
+    // select them, in the order of these bits
+    std::uint32_t bitmap;
+    typedef std::vector<nodet *> childrent;
+    childrent children;
+
+    typedef std::vector<value_type> entriest;
+    entriest entries;
+
+    std::size_t position(unsigned index) const
+    {
+      return std::bitset<children_per_node>(
+        bitmap&((std::uint32_t(1)<<index)-1)).count();
+    }
+
+    bool has_child(unsigned index) const
+    {
+      return (bitmap&(std::uint32_t(1)<<index))!=0;
+    }
+
+    const nodet *child(unsigned index) const
+    {
+      return has_child(index)?children[position(index)]:NULL;
+    }
+  };
+
+  static void remove_ref(nodet *node)
+  {
+    if(node==NULL)
+      return;
+
+    assert(node->ref_count!=0);
+
+    node->ref_count--;
+    if(node->ref_count==0)
+      delete node;
+  }
+
+  static unsigned index(std::size_t hash, unsigned level)
+  {
+    return (hash>>(bits*level))&(children_per_node-1);
+  }
+
+  nodet *root;
+  size_type num_entries;
+
+public:
+  sharing_mapt():root(NULL), num_entries(0)
+  {
+  }
+
+  sharing_mapt(const sharing_mapt &other):
+    root(other.root),
+    num_entries(other.num_entries)
+  {
+    if(root!=NULL)
+      root->ref_count++;
+  }
+
+  sharing_mapt &operator=(const sharing_mapt &other)
+  {
+    if(other.root!=NULL)
+      other.root->ref_count++;
+    remove_ref(root);
+    root=other.root;
+    num_entries=other.num_entries;
+    return *this;
+  }
+
+  ~sharing_mapt()
+  {
+    remove_ref(root);
+  }
+
+  void swap(sharing_mapt &other)
+  {
+    std::swap(root, other.root);
+    std::swap(num_entries, other.num_entries);
+  }
+
+  void clear()
+  {
+    remove_ref(root);
+    root=NULL;
+    num_entries=0;
+  }
+
+  size_type size() const
+  {
+    return num_entries;
+  }
+
+  bool empty() const
+  {
+    return num_entries==0;
+  }
+
+  // the two maps are copies of each other
+  bool is_shared_with(const sharing_mapt &other) const
+  {
+    return root==other.root;
+  }
+
+  class const_iterator
+  {
+  public:
+    const_iterator():depth(0), leaf(NULL), entry(0)
+    {
+    }
+
+    const value_type &operator*() const
+    {
+      assert(leaf!=NULL);
+      return leaf->entries[entry];
+    }
+
+    const value_type *operator->() const
+    {
+      return &**this;
+    }
+
+    const_iterator &operator++()
+    {
+      assert(leaf!=NULL);
+      entry++;
+      if(entry==leaf->entries.size())
+        next_leaf();
+      return *this;
+    }
+
+    const_iterator operator++(int)
+    {
+      const_iterator tmp(*this);
+      ++*this;
+      return tmp;
+    }
+
+    bool operator==(const const_iterator &other) const
+    {
+      return leaf==other.leaf && entry==other.entry;
+    }
+
+    bool operator!=(const const_iterator &other) const
+    {
+      return !(*this==other);
+    }
+
+  protected:
+    friend class sharing_mapt;
+
+    // the inner nodes on the path to the leaf, with the position
+    // of the next child to visit; only the first 'depth' are set
+    const nodet *path_nodes[levels];
+    std::size_t path_positions[levels];
+    unsigned depth;
+
+    const nodet *leaf;
+    std::size_t entry;
+
+    void push(const nodet *node)
+    {
+      assert(depth<levels);
+      path_nodes[depth]=node;
+      path_positions[depth]=0;
+      depth++;
+    }
+
+    // moves to the first entry of the next leaf that has one
+    void next_leaf()
+    {
+      entry=0;
+
+      while(depth!=0)
+      {
+        const nodet *top=path_nodes[depth-1];
+        std::size_t &position=path_positions[depth-1];
+
+        if(position==top->children.size())
+        {
+          depth--;
+          continue;
+        }
+
+        const nodet *node=top->children[position++];
+
+        if(!node->is_leaf())
+          push(node);
+        else if(!node->entries.empty())
+        {
+          leaf=node;
+          return;
+        }
+      }
+
+      leaf=NULL;
+    }
+  };
+
+  const_iterator begin() const
+  {
+    const_iterator it;
+
+    if(root==NULL)
+      return it;
+
+    if(root->is_leaf())
+    {
+      if(!root->entries.empty())
+        it.leaf=root;
+      return it;
+    }
+
+    it.push(root);
+    it.next_leaf();
+    return it;
+  }
+
+  const_iterator end() const
+  {
+    return const_iterator();
+  }
+
+  const_iterator find(const keyT &key) const
+  {
+    const_iterator it;
+    const nodet *node=root;
+    const std::size_t hash=hashT()(key);
+
+    for(unsigned level=0; node!=NULL; level++)
+    {
+      if(node->is_leaf())
+      {
+        for(std::size_t i=0; i<node->entries.size(); i++)
+          if(equalT()(node->entries[i].first, key))
+          {
+            it.leaf=node;
+            it.entry=i;
+            return it;
+          }
+
+        return end();
+      }
+
+      const unsigned i=index(hash, level);
+      it.push(node);
+      it.path_positions[level]=node->position(i)+1;
+      node=node->child(i);
+    }
+
+    return end();
+  }
+
+  size_type count(const keyT &key) const
+  {
+    return find(key)==end()?0:1;
+  }
+
+  // inserts the entry unless there is one for the key already;
+  // returns the value in the map, and whether it was inserted
+  std::pair<valueT &, bool> insert(const keyT &key, const valueT &value);
+
+  std::pair<valueT &, bool> insert(const value_type &entry)
+  {
+    return insert(entry.first, entry.second);
+  }
+
+  valueT &operator[](const keyT &key)
+  {
+    return insert(key, valueT()).first;
+  }
+
+  // returns the value for an existing key, to be changed
+  valueT &write(const keyT &key)
+  {
+    assert(count(key)!=0);
+    return insert(key, valueT()).first;
+  }
+
+  size_type erase(const keyT &key);
+
+  // the entries that may differ between two maps, as the key and
+  // the value in either map, or NULL if the key isn't in that map
+  struct delta_view_itemt
+  {
+    const keyT *key;
+    const valueT *value;
+    const valueT *other_value;
+  };
+
+  typedef std::vector<delta_view_itemt> delta_viewt;
+
+  // Entries in nodes that are shared between the two maps are left
+  // out; all others are included, including equal ones.
+  void get_delta_view(
+    const sharing_mapt &other,
+    delta_viewt &delta_view) const
+  {
+    delta_view.clear();
+    get_delta_view_rec(root, other.root, 0, delta_view);
+  }
+
+protected:
+  // makes the node that the pointer points to unshared
+  static nodet &write_node(nodet *&node)
+  {
+    if(node==NULL)
+      node=new nodet;
+    else if(node->ref_count>1)
+    {
+      nodet *copy=new nodet(*node);
+      remove_ref(node);
+      node=copy;
+    }
+
+    return *node;
+  }
+
+  static void split(nodet &node, unsigned level);
+
+  static void get_entries_rec(
+    const nodet *node,
+    std::vector<const value_type *> &dest);
+
+  static const valueT *find_rec(
+    const nodet *node,
+    const keyT &key,
+    unsigned level);
+
+  static void get_delta_view_rec(
+    const nodet *node,
+    const nodet *other,
+    unsigned level,
+    delta_viewt &delta_view);
+};
+
+/*******************************************************************\
+
+Function: sharing_mapt::insert
+
+  Inputs: a key and a value
+
+ Outputs: the value in the map for the key, and whether the given
+          one was inserted
+
+ Purpose: copies the nodes on the path to the entry that are shared
+
+\*******************************************************************/
+
+template<class keyT, class valueT, class hashT, class equalT>
+std::pair<valueT &, bool> sharing_mapt<keyT, valueT, hashT, equalT>::insert(
+  const keyT &key,
+  const valueT &value)
+{
+  const std::size_t hash=hashT()(key);
+  nodet **node_ptr=&root;
+  unsigned level=0;
+
+  while(true)
+  {
+    nodet &node=write_node(*node_ptr);
+
+    if(node.is_leaf())
+    {
+      for(std::size_t i=0; i<node.entries.size(); i++)
+        if(equalT()(node.entries[i].first, key))
+          return std::pair<valueT &, bool>(node.entries[i].second, false);
+
+      if(node.entries.size()<leaf_size || level+1>=levels)
+      {
+        node.entries.push_back(value_type(key, value));
+        num_entries++;
+        return std::pair<valueT &, bool>(node.entries.back().second, true);
+      }
+
+      split(node, level);
+    }
+
+    const unsigned i=index(hash, level);
+    const std::size_t pos=node.position(i);
+
+    if(!node.has_child(i))
+    {
+      node.children.insert(node.children.begin()+pos, NULL);
+      node.bitmap|=std::uint32_t(1)<<i;
+    }
+
+    node_ptr=&node.children[pos];
+    level++;
+  }
+}
+
+/*******************************************************************\
+
+Function: sharing_mapt::erase
+
+  Inputs: a key
+
+ Outputs: the number of entries erased
+
+ Purpose:
+
+\*******************************************************************/
+
+template<class keyT, class valueT, class hashT, class equalT>
+std::size_t sharing_mapt<keyT, valueT, hashT, equalT>::erase(
+  const keyT &key)
+{
+  // don't copy anything if there is nothing to erase
+  if(count(key)==0)
+    return 0;
+
+  const std::size_t hash=hashT()(key);
+  nodet **node_ptr=&root;
+  nodet *parent=NULL;
+  unsigned parent_index=0;
+
+  for(unsigned level=0; ; level++)
+  {
+    nodet &node=write_node(*node_ptr);
+
+    if(node.is_leaf())
+    {
+      for(std::size_t i=0; i<node.entries.size(); i++)
+        if(equalT()(node.entries[i].first, key))
+        {
+          node.entries.erase(node.entries.begin()+i);
+          num_entries--;
+          break;
+        }
+
+      // remove empty leaves; an inner node without children is an
+      // empty leaf itself
+      if(node.entries.empty() && parent!=NULL)
+      {
+        remove_ref(*node_ptr);
+        parent->children.erase(
+          parent->children.begin()+parent->position(parent_index));
+        parent->bitmap&=~(std::uint32_t(1)<<parent_index);
+      }
+
+      return 1;
+    }
+
+    parent=&node;
+    parent_index=index(hash, level);
+    assert(node.has_child(parent_index));
+    node_ptr=&node.children[node.position(parent_index)];
+  }
+}
+
+/*******************************************************************\
+
+Function: sharing_mapt::split
+
+  Inputs: a leaf, and its level in the trie
+
+ Outputs:
+
+ Purpose: turns the leaf into an inner node, with the entries
+          distributed over new leaves
+
+\*******************************************************************/
+
+template<class keyT, class valueT, class hashT, class equalT>
+void sharing_mapt<keyT, valueT, hashT, equalT>::split(
+  nodet &node,
+  unsigned level)
+{
+  assert(node.is_leaf());
+
+  typename nodet::entriest entries;
+  entries.swap(node.entries);
+
+  std::vector<nodet *> leaves(children_per_node, NULL);
+
+  for(typename nodet::entriest::const_iterator
+      it=entries.begin();
+      it!=entries.end();
+      it++)
+  {
+    const unsigned i=index(hashT()(it->first), level);
+
+    if(leaves[i]==NULL)
+      leaves[i]=new nodet;
+
+    leaves[i]->entries.push_back(*it);
+  }
+
+  for(unsigned i=0; i<children_per_node; i++)
+    if(leaves[i]!=NULL)
+    {
+      node.children.push_back(leaves[i]);
+      node.bitmap|=std::uint32_t(1)<<i;
+    }
+}
+
+/*******************************************************************\
+
+Function: sharing_mapt::get_entries_rec
+
+  Inputs:
+
+ Outputs: all entries under the given node
+
+ Purpose:
+
+\*******************************************************************/
+
+template<class keyT, class valueT, class hashT, class equalT>
+void sharing_mapt<keyT, valueT, hashT, equalT>::get_entries_rec(
+  const nodet *node,
+  std::vector<const value_type *> &dest)
+{
+  if(node==NULL)
+    return;
+
+  for(typename nodet::entriest::const_iterator
+      it=node->entries.begin();
+      it!=node->entries.end();
+      it++)
+    dest.push_back(&*it);
+
+  for(typename nodet::childrent::const_iterator
+      it=node->children.begin();
+      it!=node->children.end();
+      it++)
+    get_entries_rec(*it, dest);
+}
+
+/*******************************************************************\
+
+Function: sharing_mapt::find_rec
+
+  Inputs: a node at the given level, and a key
+
+ Outputs: the value for the key under the node, or NULL
+
+ Purpose:
+
+\*******************************************************************/
+
+template<class keyT, class valueT, class hashT, class equalT>
+const valueT *sharing_mapt<keyT, valueT, hashT, equalT>::find_rec(
+  const nodet *node,
+  const keyT &key,
+  unsigned level)
+{
+  const std::size_t hash=hashT()(key);
+
+  for(; node!=NULL; level++)
+  {
+    if(node->is_leaf())
+    {
+      for(typename nodet::entriest::const_iterator
+          it=node->entries.begin();
+          it!=node->entries.end();
+          it++)
+        if(equalT()(it->first, key))
+          return &it->second;
+
+      return NULL;
+    }
+
+    node=node->child(index(hash, level));
+  }
+
+  return NULL;
+}
+
+/*******************************************************************\
+
+Function: sharing_mapt::get_delta_view_rec
+
+  Inputs: two nodes at the same level, of either map
+
+ Outputs:
+
+ Purpose: adds the entries under the nodes, unless they are shared
+
+\*******************************************************************/
+
+template<class keyT, class valueT, class hashT, class equalT>
+void sharing_mapt<keyT, valueT, hashT, equalT>::get_delta_view_rec(
+  const nodet *node,
+  const nodet *other,
+  unsigned level,
+  delta_viewt &delta_view)
+{
+  if(node==other)
+    return;
+
+  if(node!=NULL && other!=NULL &&
+     !node->is_leaf() && !other->is_leaf())
+  {
+    for(unsigned i=0; i<children_per_node; i++)
+      get_delta_view_rec(
+        node->child(i), other->child(i), level+1, delta_view);
+
+    return;
+  }
+
+  // one of them is a leaf, or missing
+  std::vector<const value_type *> entries, other_entries;
+  get_entries_rec(node, entries);
+  get_entries_rec(other, other_entries);
+
+  for(typename std::vector<const value_type *>::const_iterator
+      it=entries.begin();
+      it!=entries.end();
+      it++)
+  {
+    delta_view_itemt item;
+    item.key=&(*it)->first;
+    item.value=&(*it)->second;
+    item.other_value=find_rec(other, (*it)->first, level);
+    delta_view.push_back(item);
+  }
+
+  for(typename std::vector<const value_type *>::const_iterator
+      it=other_entries.begin();
+      it!=other_entries.end();
+      it++)
+  {
+    if(find_rec(node, (*it)->first, level)!=NULL)
+      continue;
+
+    delta_view_itemt item;
+    item.key=&(*it)->first;
+    item.value=NULL;
+    item.other_value=&(*it)->second;
+    delta_view.push_back(item);
+  }
+}
+
+#endif // CPROVER_UTIL_SHARING_MAP_H
@@ -31,6 +31,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include "bv_arithmetic.h"
 #include "endianness_map.h"
 #include "simplify_utils.h"
+#include "simplify_expr_cache.h"
 
 #include <linking/zero_initializer.h>
 
@@ -41,30 +42,6 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <iostream>
 #endif
 
-// #define USE_CACHE
-
-#ifdef USE_CACHE
-struct simplify_expr_cachet
-{
-public:
-  #if 1
-  typedef std::unordered_map<
-    exprt, exprt, irep_full_hash, irep_full_eq> containert;
-  #else
-  typedef std::unordered_map<exprt, exprt, irep_hash> containert;
-  #endif
-
-  containert container_normal;
-
-  containert &container()
-  {
-    return container_normal;
-  }
-};
-
-simplify_expr_cachet simplify_expr_cache;
-#endif
-
 /*******************************************************************\
 
 Function: simplify_exprt::simplify_abs
@@ -2610,24 +2587,36 @@ Function: simplify_exprt::simplify_rec
 
 bool simplify_exprt::simplify_rec(exprt &expr)
 {
-  // look up in cache
-
-  #ifdef USE_CACHE
-  std::pair<simplify_expr_cachet::containert::iterator, bool>
-    cache_result=simplify_expr_cache.container().
-      insert(std::pair<exprt, exprt>(expr, exprt()));
+  // look up in cache; the result also depends on
+  // local_replace_map, so we only use it when that is empty
+  const bool use_cache=cache!=NULL && local_replace_map.empty();
 
-  if(!cache_result.second) // found!
+  if(use_cache)
   {
-    const exprt &new_expr=cache_result.first->second;
+    cache->set_context(ns, do_simplify_if);
 
-    if(new_expr.id()==irep_idt())
-      return true; // no change
+    // the operands are merged already when coming from the
+    // expression they belong to, which makes this cheap
+    cache->merge_full_irep(expr);
 
-    expr=new_expr;
-    return false;
+    simplify_expr_cachet::containert::const_iterator cache_entry=
+      cache->container.find(expr);
+
+    if(cache_entry!=cache->container.end()) // found!
+    {
+      cache->hits++;
+
+      const exprt &new_expr=cache_entry->second;
+
+      if(new_expr.is_nil())
+        return true; // no change
+
+      expr=new_expr;
+      return false;
+    }
+
+    cache->misses++;
   }
-  #endif
 
   // We work on a copy to prevent unnecessary destruction of sharing.
   exprt tmp=expr;
@@ -2655,13 +2644,18 @@ bool simplify_exprt::simplify_rec(exprt &expr)
   #endif
 
   if(!result)
-  {
     expr.swap(tmp);
 
-    #ifdef USE_CACHE
-    // save in cache
-    cache_result.first->second=expr;
-    #endif
+  if(use_cache)
+  {
+    if(cache->container.size()>=cache->max_size)
+      cache->clear_container();
+
+    // if changed, 'tmp' now holds the original expression
+    if(result)
+      cache->container[expr].make_nil();
+    else
+      cache->container[tmp]=expr;
   }
 
   return result;
@@ -0,0 +1,81 @@
+/*******************************************************************\
+
+Module: Cache for the Simplifier
+
+Author:
+
+\*******************************************************************/
+
+#ifndef CPROVER_UTIL_SIMPLIFY_EXPR_CACHE_H
+#define CPROVER_UTIL_SIMPLIFY_EXPR_CACHE_H
+
+#include <unordered_map>
+
+#include "expr.h"
+#include "merge_irep.h"
+
+class namespacet;
+
+/*! \brief Remembers the results of simplify_exprt across
+           instances of simplify_exprt
+
+  The results are only valid for the namespace and the options
+  they were computed with; the cache is emptied whenever these
+  change. It is also emptied when it reaches its maximum size.
+*/
+class simplify_expr_cachet
+{
+public:
+  explicit simplify_expr_cachet(std::size_t _max_size=1<<18):
+    max_size(_max_size),
+    hits(0),
+    misses(0),
+    ns(NULL),
+    do_simplify_if(true)
+  {
+  }
+
+  // The expression maps to nil if it doesn't simplify. The keys
+  // are merged by merge_full_irep, and are thus looked up by the
+  // identity of their nodes, without walking them. The comments
+  // are compared, too, as the result of simplifying an expression
+  // keeps comments of it, e.g., the source location.
+  typedef std::unordered_map<
+    exprt, exprt, merged_full_irep_hash, merged_full_irep_eq> containert;
+  containert container;
+
+  merge_full_irept merge_full_irep;
+
+  std::size_t max_size;
+
+  // statistics
+  std::size_t hits, misses;
+
+  void set_context(const namespacet &_ns, bool _do_simplify_if)
+  {
+    if(ns!=&_ns || do_simplify_if!=_do_simplify_if)
+    {
+      clear_container();
+      ns=&_ns;
+      do_simplify_if=_do_simplify_if;
+    }
+  }
+
+  void clear()
+  {
+    clear_container();
+    hits=misses=0;
+  }
+
+  void clear_container()
+  {
+    container.clear();
+    merge_full_irep.clear();
+  }
+
+protected:
+  const namespacet *ns;
+  bool do_simplify_if;
+};
+
+#endif // CPROVER_UTIL_SIMPLIFY_EXPR_CACHE_H
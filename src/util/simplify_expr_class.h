@@ -27,6 +27,7 @@ class if_exprt;
 class index_exprt;
 class member_exprt;
 class namespacet;
+class simplify_expr_cachet;
 class tvt;
 
 #define forall_value_list(it, value_list) \
@@ -38,7 +39,8 @@ class simplify_exprt
 public:
   explicit simplify_exprt(const namespacet &_ns):
     do_simplify_if(true),
-    ns(_ns)
+    ns(_ns),
+    cache(NULL)
 #ifdef DEBUG_ON_DEMAND
     , debug_on(false)
 #endif
@@ -55,6 +57,13 @@ public:
 
   bool do_simplify_if;
 
+  // keep the results in the given cache, which may outlive
+  // this instance
+  void set_cache(simplify_expr_cachet &_cache)
+  {
+    cache=&_cache;
+  }
+
   // These below all return 'true' if the simplification wasn't applicable.
   // If false is returned, the expression has changed.
 
@@ -148,6 +157,7 @@ public:
 
 protected:
   const namespacet &ns;
+  simplify_expr_cachet *cache;
 #ifdef DEBUG_ON_DEMAND
   bool debug_on;
 #endif
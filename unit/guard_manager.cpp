@@ -0,0 +1,73 @@
+#include <cassert>
+
+#include <util/std_expr.h>
+
+#include <goto-symex/guard_manager.h>
+
+// gives access to the BDDs of the guards
+class guard_manager_testt:public guard_managert
+{
+public:
+  unsigned node(const exprt &expr)
+  {
+    return from_expr(expr).node_number();
+  }
+};
+
+int main()
+{
+  guard_manager_testt guard_manager;
+
+  symbol_exprt a("a", bool_typet());
+  symbol_exprt b("b", bool_typet());
+  symbol_exprt c("c", bool_typet());
+
+  // the same conjunction, built in different orders
+  guardt g1, g2;
+  g1.add(a);
+  g1.add(b);
+  g1.add(c);
+  g2.add(c);
+  g2.add(a);
+  g2.add(b);
+  assert(!(g1==g2));
+  assert(guard_manager.node(g1)==guard_manager.node(g2));
+
+  guard_manager.canonicalize(g1);
+  guard_manager.canonicalize(g2);
+  assert(g1==g2);
+
+  // the canonical form maps back to the same BDD
+  unsigned node=guard_manager.node(g1);
+  guard_manager.canonicalize(g1);
+  assert(g1==g2);
+  assert(guard_manager.node(g1)==node);
+
+  // the same disjunction, built in different orders
+  guardt not_b;
+  not_b.add(not_exprt(b));
+  guardt d1=g1, d2=not_b;
+  guard_manager.disjoin(d1, not_b);
+  guard_manager.disjoin(d2, g2);
+  assert(d1==d2);
+
+  // the two branches of a condition merge into the guard before it
+  guardt before, then_branch, else_branch;
+  before.add(a);
+  guard_manager.canonicalize(before);
+  then_branch=before;
+  then_branch.add(b);
+  else_branch=before;
+  else_branch.add(not_exprt(b));
+  guard_manager.canonicalize(then_branch);
+  guard_manager.canonicalize(else_branch);
+  guard_manager.disjoin(then_branch, else_branch);
+  assert(then_branch==before);
+
+  // a guard that can't be satisfied becomes false
+  guardt infeasible=g1;
+  infeasible.add(not_exprt(a));
+  assert(!infeasible.is_false());
+  guard_manager.canonicalize(infeasible);
+  assert(infeasible.is_false());
+}
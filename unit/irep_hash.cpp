@@ -0,0 +1,92 @@
+#include <cassert>
+
+#include <util/irep.h>
+#include <util/merge_irep.h>
+
+static irept make_tree(const irep_idt &leaf)
+{
+  irept tree("parent");
+  tree.get_sub().push_back(irept("child"));
+  tree.get_sub().back().get_sub().push_back(irept(leaf));
+  tree.set("name", "value");
+  return tree;
+}
+
+// the same node
+static bool same(const irept &a, const irept &b)
+{
+  return &a.get_sub()==&b.get_sub();
+}
+
+int main()
+{
+  irept tree=make_tree("a");
+
+  // a reference into the tree, taken before the tree is hashed
+  irept &child=tree.get_sub().front();
+
+  std::size_t hash_a=tree.hash();
+  assert(hash_a==make_tree("a").hash());
+
+  // changes the child, but not the parent node
+  child.get_sub().front().id("b");
+
+  irept other=make_tree("b");
+  other.hash();
+
+  assert(tree==other);
+  assert(other==tree);
+  assert(!(tree==make_tree("a")));
+  assert(tree.hash()==other.hash());
+
+  // the same, with the tree shared while it's hashed
+  {
+    irept copy=tree;
+    assert(copy.hash()==other.hash());
+  }
+
+  child.get_sub().front().id("c");
+  assert(tree==make_tree("c"));
+  assert(!(tree==other));
+  assert(tree.hash()==make_tree("c").hash());
+
+  // hashing a copy gives the same hash as the original
+  irept copy=other;
+  assert(copy.hash()==other.hash());
+  copy.id("changed");
+  assert(!(copy==other));
+  assert(other==make_tree("b"));
+  assert(copy.hash()!=other.hash());
+
+  // hash-consing
+  merge_full_irept merge_full_irep;
+
+  irept m1=make_tree("a"), m2=make_tree("a");
+  assert(!same(m1, m2));
+  merge_full_irep(m1);
+  merge_full_irep(m2);
+  assert(same(m1, m2));
+  assert(same(m1.get_sub().front(), m2.get_sub().front()));
+
+  // comments are kept
+  irept commented=make_tree("a");
+  commented.set("#comment", "x");
+  merge_full_irep(commented);
+  assert(!same(commented, m1));
+  assert(commented==m1);
+  assert(!commented.full_eq(m1));
+  assert(commented.get("#comment")=="x");
+  assert(same(commented.get_sub().front(), m1.get_sub().front()));
+
+  // changing a merged irep copies it, and leaves the others alone
+  m2.get_sub().front().get_sub().front().id("b");
+  assert(!same(m1, m2));
+  assert(m1==make_tree("a"));
+  assert(m2==make_tree("b"));
+  merge_full_irep(m2);
+  irept m3=make_tree("b");
+  merge_full_irep(m3);
+  assert(same(m2, m3));
+  assert(m2.hash()==m3.hash());
+  assert(m1.hash()!=m2.hash());
+}
@@ -0,0 +1,82 @@
+#include <cassert>
+#include <sstream>
+
+#include <util/message.h>
+#include <util/tempdir.h>
+
+#include <java_bytecode/java_bytecode_parser.h>
+#include <java_bytecode/java_class_cache.h>
+
+// what the conversion takes from a parse tree
+static std::string dump(const java_bytecode_parse_treet &parse_tree)
+{
+  const java_bytecode_parse_treet::classt &parsed_class=
+    parse_tree.parsed_class;
+
+  std::ostringstream out;
+
+  out << parsed_class.name << " extends " << parsed_class.extends
+      << ' ' << parse_tree.loading_successful << '\n';
+
+  for(const auto &class_ref : parse_tree.class_refs)
+    out << "ref " << class_ref << '\n';
+
+  for(const auto &field : parsed_class.fields)
+    out << "field " << field.name << ' ' << field.signature
+        << ' ' << field.is_static << '\n';
+
+  for(const auto &method : parsed_class.methods)
+  {
+    out << "method " << method.name << ' ' << method.signature
+        << ' ' << method.is_static << ' ' << method.is_abstract << '\n'
+        << method.source_location.pretty() << '\n';
+
+    for(const auto &instruction : method.instructions)
+    {
+      out << instruction.address << ' ' << instruction.statement
+          << ' ' << instruction.source_location.pretty() << '\n';
+
+      for(const auto &arg : instruction.args)
+        out << arg.pretty() << '\n';
+    }
+
+    for(const auto &local_variable : method.local_variable_table)
+      out << "local " << local_variable.name << ' '
+          << local_variable.signature << ' ' << local_variable.index
+          << ' ' << local_variable.start_pc << ' '
+          << local_variable.length << '\n';
+  }
+
+  return out.str();
+}
+
+int main()
+{
+  null_message_handlert message_handler;
+
+  java_bytecode_parse_treet parse_tree;
+  bool error=java_bytecode_parse(
+    "../regression/cbmc-java/virtual2/virtual2.class",
+    parse_tree,
+    message_handler);
+  assert(!error);
+  assert(!parse_tree.parsed_class.methods.empty());
+
+  temp_dirt temp_dir("java_class_cache_XXXXXX");
+  const java_class_cachet class_cache(temp_dir.path);
+
+  java_bytecode_parse_treet cached;
+  assert(!class_cache.read("a.jar", "virtual2.class", 1, cached));
+
+  assert(!class_cache.write("a.jar", "virtual2.class", 1, parse_tree));
+
+  // a hit gives the same parse tree
+  assert(class_cache.read("a.jar", "virtual2.class", 1, cached));
+  assert(dump(cached)==dump(parse_tree));
+
+  // another version of the class file, or another JAR file, misses
+  java_bytecode_parse_treet other;
+  assert(!class_cache.read("a.jar", "virtual2.class", 2, other));
+  assert(!class_cache.read("b.jar", "virtual2.class", 1, other));
+  assert(!class_cache.read("a.jar", "A.class", 1, other));
+}
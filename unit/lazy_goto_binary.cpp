@@ -0,0 +1,130 @@
+#include <cassert>
+#include <fstream>
+#include <sstream>
+
+#include <util/message.h>
+#include <util/std_code.h>
+#include <util/std_expr.h>
+#include <util/symbol_table.h>
+#include <util/tempfile.h>
+
+#include <goto-programs/lazy_goto_binary.h>
+#include <goto-programs/write_goto_binary.h>
+
+static code_typet function_type()
+{
+  code_typet type;
+  type.return_type()=empty_typet();
+  return type;
+}
+
+// a function whose body calls 'callee', if given, and
+// mentions 'mentioned', if given
+static void add_function(
+  symbol_tablet &symbol_table,
+  goto_functionst &goto_functions,
+  const irep_idt &name,
+  const irep_idt &callee,
+  const irep_idt &mentioned)
+{
+  symbolt symbol;
+  symbol.name=name;
+  symbol.base_name=name;
+  symbol.type=function_type();
+  symbol.mode=ID_C;
+  symbol_table.add(symbol);
+
+  goto_programt &body=goto_functions.function_map[name].body;
+  goto_functions.function_map[name].type=function_type();
+
+  if(callee!=irep_idt())
+  {
+    code_function_callt call;
+    call.function()=symbol_exprt(callee, function_type());
+    body.add_instruction(FUNCTION_CALL)->code=call;
+  }
+
+  if(mentioned!=irep_idt())
+  {
+    code_expressiont expression(
+      address_of_exprt(symbol_exprt(mentioned, function_type())));
+    body.add_instruction(OTHER)->code=expression;
+  }
+
+  body.add_instruction(END_FUNCTION);
+}
+
+static void write_file(const std::string &name, const std::string &data)
+{
+  std::ofstream out(name, std::ios::binary);
+  out << data;
+}
+
+int main()
+{
+  symbol_tablet symbol_table;
+  goto_functionst goto_functions;
+
+  add_function(symbol_table, goto_functions, ID__start, "main", "");
+  add_function(symbol_table, goto_functions, "main", "f", "h");
+  add_function(symbol_table, goto_functions, "f", "", "");
+  add_function(symbol_table, goto_functions, "g", "f", "");
+  add_function(symbol_table, goto_functions, "h", "", "");
+
+  std::ostringstream out;
+  assert(!write_goto_binary(out, symbol_table, goto_functions, 4));
+  const std::string binary=out.str();
+
+  temporary_filet file("lazy_goto_binary", ".gb");
+  null_message_handlert message_handler;
+
+  // only g can't be reached
+  {
+    write_file(file(), binary);
+
+    symbol_tablet new_symbol_table;
+    goto_functionst new_goto_functions;
+    lazy_goto_binaryt lazy_goto_binary(
+      new_symbol_table, new_goto_functions, message_handler);
+
+    assert(!lazy_goto_binary.read(file()));
+    assert(new_symbol_table.symbols.size()==5);
+    assert(lazy_goto_binary.number_of_unloaded_functions()==5);
+
+    assert(!lazy_goto_binary.load_reachable(ID__start));
+    assert(lazy_goto_binary.number_of_unloaded_functions()==1);
+    assert(new_goto_functions.function_map["h"].body_available());
+    assert(new_goto_functions.function_map["main"].body.instructions.size()==3);
+    assert(!new_goto_functions.function_map["g"].body_available());
+
+    assert(!lazy_goto_binary.load("g"));
+    assert(new_goto_functions.function_map["g"].body.instructions.size()==2);
+    assert(lazy_goto_binary.load("no_such_function"));
+  }
+
+  // truncated files are reported, rather than read
+  for(std::size_t size=0; size<binary.size(); size++)
+  {
+    write_file(file(), binary.substr(0, size));
+
+    symbol_tablet new_symbol_table;
+    goto_functionst new_goto_functions;
+    lazy_goto_binaryt lazy_goto_binary(
+      new_symbol_table, new_goto_functions, message_handler);
+
+    bool error;
+
+    try
+    {
+      error=lazy_goto_binary.read(file()) ||
+            lazy_goto_binary.load_all();
+    }
+
+    catch(int)
+    {
+      error=true;
+    }
+
+    assert(error);
+  }
+}
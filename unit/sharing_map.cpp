@@ -0,0 +1,141 @@
+#include <cassert>
+#include <map>
+#include <string>
+
+#include <util/sharing_map.h>
+
+typedef sharing_mapt<unsigned, std::string> mapt;
+
+// puts all keys into the same leaf, which can't be split
+struct collision_hasht
+{
+  std::size_t operator()(unsigned) const { return 0; }
+};
+
+typedef sharing_mapt<unsigned, std::string, collision_hasht> collision_mapt;
+
+template<class M>
+void check_against(const M &map, const std::map<unsigned, std::string> &ref)
+{
+  assert(map.size()==ref.size());
+
+  std::size_t count=0;
+  for(typename M::const_iterator it=map.begin(); it!=map.end(); it++)
+  {
+    std::map<unsigned, std::string>::const_iterator r_it=ref.find(it->first);
+    assert(r_it!=ref.end());
+    assert(r_it->second==it->second);
+    count++;
+  }
+  assert(count==ref.size());
+
+  for(std::map<unsigned, std::string>::const_iterator
+      it=ref.begin(); it!=ref.end(); it++)
+  {
+    typename M::const_iterator m_it=map.find(it->first);
+    assert(m_it!=map.end());
+    assert(m_it->second==it->second);
+  }
+}
+
+template<class M>
+void test_basic()
+{
+  M map;
+  std::map<unsigned, std::string> ref;
+
+  assert(map.empty());
+  assert(map.begin()==map.end());
+  assert(map.find(1)==map.end());
+
+  for(unsigned i=0; i<1000; i++)
+  {
+    std::string value=std::to_string(i*7);
+    assert(map.insert(i*7919, value).second);
+    ref[i*7919]=value;
+  }
+
+  assert(!map.insert(7919, "x").second);
+  check_against(map, ref);
+
+  // iterating from a found entry visits the rest
+  std::size_t count=0;
+  for(typename M::const_iterator it=map.find(ref.begin()->first);
+      it!=map.end();
+      it++)
+    count++;
+  assert(count>=1 && count<=ref.size());
+
+  for(unsigned i=0; i<1000; i+=3)
+  {
+    assert(map.erase(i*7919)==1);
+    ref.erase(i*7919);
+  }
+
+  assert(map.erase(1)==0);
+  check_against(map, ref);
+}
+
+void test_sharing()
+{
+  mapt map;
+  for(unsigned i=0; i<1000; i++)
+    map[i]=std::to_string(i);
+
+  mapt copy=map;
+  assert(copy.is_shared_with(map));
+
+  copy[5]="five";
+  copy.erase(6);
+  copy[1000]="1000";
+
+  assert(map.find(5)->second=="5");
+  assert(map.count(6)==1);
+  assert(map.count(1000)==0);
+  assert(copy.find(5)->second=="five");
+  assert(copy.count(6)==0);
+  assert(map.size()==1000);
+  assert(copy.size()==1000);
+
+  mapt::delta_viewt delta;
+  copy.get_delta_view(map, delta);
+
+  // only the unshared leaves are visited
+  assert(delta.size()<100);
+
+  bool seen5=false, seen6=false, seen1000=false;
+
+  for(mapt::delta_viewt::const_iterator
+      it=delta.begin(); it!=delta.end(); it++)
+  {
+    if(*it->key==5)
+    {
+      assert(*it->value=="five" && *it->other_value=="5");
+      seen5=true;
+    }
+    else if(*it->key==6)
+    {
+      assert(it->value==NULL && *it->other_value=="6");
+      seen6=true;
+    }
+    else if(*it->key==1000)
+    {
+      assert(*it->value=="1000" && it->other_value==NULL);
+      seen1000=true;
+    }
+    else
+      assert(*it->value==*it->other_value);
+  }
+
+  assert(seen5 && seen6 && seen1000);
+
+  map.get_delta_view(map, delta);
+  assert(delta.empty());
+}
+
+int main()
+{
+  test_basic<mapt>();
+  test_basic<collision_mapt>();
+  test_sharing();
+}
@@ -0,0 +1,50 @@
+#include <cassert>
+
+#include <util/arith_tools.h>
+#include <util/namespace.h>
+#include <util/simplify_expr_cache.h>
+#include <util/simplify_expr_class.h>
+#include <util/std_expr.h>
+#include <util/symbol_table.h>
+
+// x+0, with the given location on x
+static exprt make_expr(const std::string &line)
+{
+  signedbv_typet type(32);
+  symbol_exprt x("x", type);
+
+  source_locationt location;
+  location.set_line(line);
+  x.add_source_location()=location;
+
+  return plus_exprt(x, from_integer(0, type));
+}
+
+int main()
+{
+  symbol_tablet symbol_table;
+  namespacet ns(symbol_table);
+
+  simplify_expr_cachet cache;
+
+  simplify_exprt simplify(ns);
+  simplify.set_cache(cache);
+
+  exprt e1=make_expr("1");
+  assert(!simplify.simplify(e1));
+  assert(e1.id()==ID_symbol);
+  assert(e1.source_location().get_line()=="1");
+
+  // the same, but with another location, isn't taken from the cache
+  exprt e2=make_expr("2");
+  assert(!simplify.simplify(e2));
+  assert(e2.id()==ID_symbol);
+  assert(e2.source_location().get_line()=="2");
+
+  // this one is
+  const std::size_t hits=cache.hits;
+  exprt e3=make_expr("1");
+  assert(!simplify.simplify(e3));
+  assert(e3.source_location().get_line()=="1");
+  assert(cache.hits>hits);
+}
@@ -0,0 +1,96 @@
+#include <cassert>
+#include <cstdlib>
+#include <fstream>
+#include <signal.h>
+#include <sys/stat.h>
+
+#include <util/namespace.h>
+#include <util/pipe_stream.h>
+#include <util/std_expr.h>
+#include <util/symbol_table.h>
+#include <util/tempdir.h>
+
+#include <solvers/smt2/smt2_dec.h>
+
+static bool sigpipe_is_ignored()
+{
+  struct sigaction current;
+  sigaction(SIGPIPE, NULL, &current);
+  return current.sa_handler==SIG_IGN;
+}
+
+int main()
+{
+  assert(!sigpipe_is_ignored());
+
+  temp_dirt temp_dir("smt2_dec_XXXXXX");
+
+  // a stand-in for z3 that logs its input and finds
+  // everything unsatisfiable
+  const std::string log=temp_dir("log");
+  const std::string z3=temp_dir("z3");
+
+  {
+    std::ofstream script(z3.c_str());
+    script << "#!/bin/sh\n"
+           << "while read -r line; do\n"
+           << "  echo \"$line\" >> " << log << "\n"
+           << "  case \"$line\" in\n"
+           << "    *check-sat*) echo unsat ;;\n"
+           << "    *exit*) exit 0 ;;\n"
+           << "  esac\n"
+           << "done\n";
+  }
+
+  chmod(z3.c_str(), 0755);
+  setenv("PATH", (temp_dir.path+":"+getenv("PATH")).c_str(), 1);
+
+  symbol_tablet symbol_table;
+  namespacet ns(symbol_table);
+
+  {
+    smt2_dect smt2_dec(ns, "test", "", "QF_AUFBV", smt2_dect::Z3);
+
+    bvt assumptions;
+    assumptions.push_back(const_literal(true));
+    assumptions.push_back(smt2_dec.convert(symbol_exprt("b", bool_typet())));
+    smt2_dec.set_assumptions(assumptions);
+    assert(smt2_dec.dec_solve()==decision_proceduret::D_UNSATISFIABLE);
+
+    assumptions.clear();
+    assumptions.push_back(const_literal(false));
+    smt2_dec.set_assumptions(assumptions);
+    assert(smt2_dec.dec_solve()==decision_proceduret::D_UNSATISFIABLE);
+  }
+
+  // constants are not passed to check-sat-assuming
+  std::ifstream in(log.c_str());
+  std::string line;
+  unsigned check_sat_assuming=0, assert_false=0;
+
+  while(std::getline(in, line))
+  {
+    if(line.find("(check-sat-assuming")==0)
+    {
+      check_sat_assuming++;
+      assert(line.find("true")==std::string::npos);
+      assert(line.find("false")==std::string::npos);
+    }
+    else if(line=="(assert false)")
+      assert_false++;
+  }
+
+  assert(check_sat_assuming==1);
+  assert(assert_false==1);
+
+  // SIGPIPE is ignored once the first process was started, and
+  // writing to a process that has terminated fails instead
+  assert(sigpipe_is_ignored());
+
+  pipe_streamt process("true", std::list<std::string>());
+  assert(process.run()>=0);
+  process.wait();
+
+  process << std::string(1<<16, ' ') << std::flush;
+  assert(!process);
+}
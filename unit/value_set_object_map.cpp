@@ -0,0 +1,77 @@
+#include <cassert>
+
+#include <pointer-analysis/value_set.h>
+
+typedef value_sett::object_map_dt object_map_dt;
+typedef value_sett::objectt objectt;
+
+int main()
+{
+  object_map_dt a, b, u;
+
+  a[1]=objectt(0);
+  a[3]=objectt(4);
+  a[5]=objectt();
+
+  b[2]=objectt(0);
+  b[3]=objectt(8);
+  b[5]=objectt(2);
+
+  // the union is sorted, and conflicting or unknown
+  // offsets become unknown
+  u.make_union(a, b);
+  assert(u.size()==4);
+
+  object_map_dt::const_iterator it=u.begin();
+  assert(it->first==1 && it->second.offset_is_zero());
+  ++it;
+  assert(it->first==2 && it->second.offset_is_zero());
+  ++it;
+  assert(it->first==3 && !it->second.offset_is_set);
+  ++it;
+  assert(it->first==5 && !it->second.offset_is_set);
+
+  // equal offsets are kept
+  object_map_dt c;
+  c[3]=objectt(4);
+  u.make_union(a, c);
+  assert(u.size()==3);
+  assert(u.find(3)->second.offset_is_set);
+  assert(u.find(3)->second.offset==4);
+
+  // an unknown offset includes all offsets, but not vice versa
+  assert(a.includes(c));
+  assert(a.includes(a));
+  assert(!c.includes(a));
+  assert(!a.includes(b));
+
+  object_map_dt d;
+  d[5]=objectt(7);
+  assert(a.includes(d));
+  assert(!d.includes(a));
+
+  c[3]=objectt(5);
+  assert(!a.includes(c));
+  assert(a.includes(object_map_dt()));
+
+  // value_sett::make_union tells whether something changed
+  value_sett value_set;
+  value_sett::object_mapt dest, src;
+  dest.write()=a;
+  src.write()=d;
+  assert(!value_set.make_union(dest, src));
+  assert(dest.read().size()==3);
+
+  src.write()=b;
+  assert(value_set.make_union(dest, src));
+  assert(dest.read().size()==4);
+  assert(!dest.read().find(3)->second.offset_is_set);
+
+  // the other way round gives the same
+  value_sett::object_mapt dest2;
+  dest2.write()=b;
+  src.write()=a;
+  assert(value_set.make_union(dest2, src));
+  assert(dest2.read().size()==4);
+  assert(!value_set.make_union(dest2, dest));
+}